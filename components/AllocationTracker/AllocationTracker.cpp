@@ -0,0 +1,214 @@
+#include <new>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+
+#include "AllocationTracker.h"
+
+namespace GameUtils
+{
+    namespace
+    {
+        //Plain data with constant initialization, safe to touch from operator new at any point of a thread's life
+        struct ThreadAllocationState
+        {
+            AllocationCounters counters;
+            uint32_t sampleCountdown = 0;
+        };
+        thread_local ThreadAllocationState threadState;
+
+        //Over budget ticks are reported at most once per this many ticks, the report carries the count in between
+        constexpr Tick reportInterval = 60;
+    }
+
+    AllocationTracker& AllocationTracker::Instance()
+    {
+        static AllocationTracker instance;
+        return instance;
+    }
+
+    AllocationCounters AllocationTracker::ThreadCounters()
+    {
+        return threadState.counters;
+    }
+
+    void AllocationTracker::OnAllocate(const std::size_t& bytes)
+    {
+        auto& state = threadState;
+        ++state.counters.allocations;
+        state.counters.bytes += bytes;
+
+        auto interval = s_sampleInterval.load(std::memory_order_relaxed);
+        if(interval == 0) return;
+        if(state.sampleCountdown == 0 || state.sampleCountdown > interval)
+            state.sampleCountdown = interval;
+        if(--state.sampleCountdown == 0)
+        {
+            auto zone = Profiler::CurrentZone();
+            auto bucket = zone < sampleBuckets - 1 ? zone : sampleBuckets - 1;
+            s_zoneSamples[bucket].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void AllocationTracker::OnFree()
+    {
+        ++threadState.counters.frees;
+    }
+
+    void AllocationTracker::SetTickBudget(const uint64_t& allocations)
+    {
+        m_tickStats.budget = allocations;
+        m_tickStats.overBudgetTicks = 0;
+        m_unreportedOverBudget = 0;
+    }
+
+    void AllocationTracker::BeginTick()
+    {
+        m_tickStart = ThreadCounters();
+    }
+
+    AllocationCounters AllocationTracker::EndTick(const Tick& tick)
+    {
+        auto now = ThreadCounters();
+        AllocationCounters tickCounters{now.allocations - m_tickStart.allocations, now.frees - m_tickStart.frees, now.bytes - m_tickStart.bytes};
+
+        m_tickStats.lastTick = tickCounters;
+        if(tickCounters.allocations > m_tickStats.worstTickAllocations)
+        {
+            m_tickStats.worstTickAllocations = tickCounters.allocations;
+            m_tickStats.worstTick = tick;
+        }
+
+        if(m_tickStats.budget > 0 && tickCounters.allocations > m_tickStats.budget)
+        {
+            ++m_tickStats.overBudgetTicks;
+            ++m_unreportedOverBudget;
+            if(m_lastReportedTick == 0 || tick >= m_lastReportedTick + reportInterval)
+            {
+                std::cerr << "tick " << tick << ": " << tickCounters.allocations << " allocations, " << tickCounters.bytes << " bytes (budget "
+                          << m_tickStats.budget << ", " << m_unreportedOverBudget << " ticks over budget since last report)" << std::endl;
+                m_lastReportedTick = tick;
+                m_unreportedOverBudget = 0;
+            }
+        }
+        return tickCounters;
+    }
+
+    TickAllocationStats AllocationTracker::GetTickStats() const
+    {
+        return m_tickStats;
+    }
+
+    void AllocationTracker::SetSampleInterval(const uint32_t& interval)
+    {
+        s_sampleInterval.store(interval, std::memory_order_relaxed);
+    }
+
+    std::vector<ZoneAllocations> AllocationTracker::GetZoneSamples() const
+    {
+        std::vector<ZoneAllocations> zones;
+        for(std::size_t bucket = 0; bucket < sampleBuckets; ++bucket)
+        {
+            auto samples = s_zoneSamples[bucket].load(std::memory_order_relaxed);
+            if(samples == 0) continue;
+            auto name = bucket == sampleBuckets - 1 ? std::string("(no zone)") : Profiler::Instance().GetZoneName(static_cast<ZoneId>(bucket));
+            zones.push_back({name, samples});
+        }
+        std::sort(zones.begin(), zones.end(), [](const ZoneAllocations& lhs, const ZoneAllocations& rhs){ return lhs.samples > rhs.samples; });
+        return zones;
+    }
+}
+
+namespace
+{
+    //Only successful attempts are counted, a new_handler retry is one allocation
+    void* TrackedAllocate(std::size_t bytes)
+    {
+        auto memory = std::malloc(bytes == 0 ? 1 : bytes);
+        if(memory != nullptr)
+            GameUtils::AllocationTracker::OnAllocate(bytes);
+        return memory;
+    }
+
+    void* TrackedAllocateAligned(std::size_t bytes, std::align_val_t alignment)
+    {
+        auto align = std::max(static_cast<std::size_t>(alignment), sizeof(void*));
+        void* memory = nullptr;
+#ifdef _WIN32
+        memory = _aligned_malloc(bytes == 0 ? 1 : bytes, align);
+#else
+        if(posix_memalign(&memory, align, bytes == 0 ? 1 : bytes) != 0)
+            memory = nullptr;
+#endif
+        if(memory != nullptr)
+            GameUtils::AllocationTracker::OnAllocate(bytes);
+        return memory;
+    }
+
+    void TrackedFree(void* memory)
+    {
+        if(memory == nullptr) return;
+        GameUtils::AllocationTracker::OnFree();
+        std::free(memory);
+    }
+
+    void TrackedFreeAligned(void* memory)
+    {
+        if(memory == nullptr) return;
+        GameUtils::AllocationTracker::OnFree();
+#ifdef _WIN32
+        _aligned_free(memory);
+#else
+        std::free(memory);
+#endif
+    }
+
+    //Standard operator new contract: on failure call the installed new_handler and retry, throw bad_alloc once there is none
+    template<typename Allocate>
+    void* AllocateOrThrow(Allocate&& allocate)
+    {
+        while(true)
+        {
+            if(auto memory = allocate(); memory != nullptr) return memory;
+            auto handler = std::get_new_handler();
+            if(handler == nullptr) throw std::bad_alloc();
+            handler();
+        }
+    }
+
+    //The nothrow forms behave like the throwing ones, new_handler included, and report failure as nullptr
+    template<typename Allocate>
+    void* AllocateOrNull(Allocate&& allocate) noexcept
+    {
+        try
+        {
+            return AllocateOrThrow(allocate);
+        }
+        catch(...)
+        {
+            return nullptr;
+        }
+    }
+}
+
+void* operator new(std::size_t bytes) { return AllocateOrThrow([&]{ return TrackedAllocate(bytes); }); }
+void* operator new[](std::size_t bytes) { return AllocateOrThrow([&]{ return TrackedAllocate(bytes); }); }
+void* operator new(std::size_t bytes, const std::nothrow_t&) noexcept { return AllocateOrNull([&]{ return TrackedAllocate(bytes); }); }
+void* operator new[](std::size_t bytes, const std::nothrow_t&) noexcept { return AllocateOrNull([&]{ return TrackedAllocate(bytes); }); }
+void* operator new(std::size_t bytes, std::align_val_t alignment) { return AllocateOrThrow([&]{ return TrackedAllocateAligned(bytes, alignment); }); }
+void* operator new[](std::size_t bytes, std::align_val_t alignment) { return AllocateOrThrow([&]{ return TrackedAllocateAligned(bytes, alignment); }); }
+void* operator new(std::size_t bytes, std::align_val_t alignment, const std::nothrow_t&) noexcept { return AllocateOrNull([&]{ return TrackedAllocateAligned(bytes, alignment); }); }
+void* operator new[](std::size_t bytes, std::align_val_t alignment, const std::nothrow_t&) noexcept { return AllocateOrNull([&]{ return TrackedAllocateAligned(bytes, alignment); }); }
+
+void operator delete(void* memory) noexcept { TrackedFree(memory); }
+void operator delete[](void* memory) noexcept { TrackedFree(memory); }
+void operator delete(void* memory, std::size_t) noexcept { TrackedFree(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { TrackedFree(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { TrackedFree(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { TrackedFree(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { TrackedFreeAligned(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { TrackedFreeAligned(memory); }
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept { TrackedFreeAligned(memory); }
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept { TrackedFreeAligned(memory); }
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFreeAligned(memory); }
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFreeAligned(memory); }
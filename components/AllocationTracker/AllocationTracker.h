@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "GameUtils/GameUtils.h"
+#include "Profiler/Profiler.h"
+
+namespace GameUtils
+{
+    struct AllocationCounters
+    {
+        uint64_t allocations = 0;
+        uint64_t frees = 0;
+        uint64_t bytes = 0;
+    };
+
+    struct TickAllocationStats
+    {
+        // Allocations made by the simulation thread during the last tick
+        AllocationCounters lastTick;
+        uint64_t worstTickAllocations = 0;
+        Tick worstTick = 0;
+        // Ticks that went over the budget since it was set
+        uint64_t overBudgetTicks = 0;
+        uint64_t budget = 0;
+    };
+
+    struct ZoneAllocations
+    {
+        std::string zone;
+        uint64_t samples = 0;
+    };
+
+    // Counts every global operator new and delete per thread. The simulation thread brackets each tick with BeginTick
+    // and EndTick to get its allocations for that tick, checked against an optional budget. Work between ticks is not charged. Sampled allocations are attributed
+    // to the profiler zone open on the allocating thread.
+    class AllocationTracker
+    {
+    public:
+        static AllocationTracker& Instance();
+
+        AllocationTracker(const AllocationTracker&) = delete;
+        AllocationTracker& operator=(const AllocationTracker&) = delete;
+
+        // Counters of the calling thread since it started
+        static AllocationCounters ThreadCounters();
+
+        // Budget in allocations per tick, 0 disables the check. Ticks over it are counted and reported on stderr.
+        void SetTickBudget(const uint64_t& allocations);
+        void BeginTick();
+        AllocationCounters EndTick(const Tick& tick);
+        TickAllocationStats GetTickStats() const;
+
+        // Every interval-th allocation of a thread is sampled, 0 turns sampling off. Attribution needs the profiler enabled.
+        void SetSampleInterval(const uint32_t& interval);
+        // Sampled allocations per zone, most sampled first. Allocations outside any zone are listed as "(no zone)".
+        std::vector<ZoneAllocations> GetZoneSamples() const;
+
+        // Called by the operator new replacements only
+        static void OnAllocate(const std::size_t& bytes);
+        static void OnFree();
+
+    private:
+        AllocationTracker() = default;
+
+        static constexpr std::size_t sampleBuckets = 256;
+
+        static inline std::atomic<uint32_t> s_sampleInterval = 0;
+        static inline std::array<std::atomic<uint64_t>, sampleBuckets> s_zoneSamples{};
+
+        AllocationCounters m_tickStart;
+        TickAllocationStats m_tickStats;
+        Tick m_lastReportedTick = 0;
+        uint64_t m_unreportedOverBudget = 0;
+    };
+}
@@ -0,0 +1,67 @@
+#include <cmath>
+
+#include "Background.h"
+#include "Profiler/Profiler.h"
+
+namespace GameEngine
+{
+    void Background::AddLayer(const std::string& texturePath, const float& scrollSpeed, const sf::Vector2f& targetSize)
+    {
+        BackgroundLayer layer{texturePath, GameUtils::TextureCache::Instance().Get(texturePath), sf::Sprite(), scrollSpeed, 0.0f, 0.0f};
+
+        layer.sprite.setTexture(*layer.texture);
+        auto textureSize = sf::Vector2f(layer.texture->getSize());
+        if(targetSize.x > 0 && targetSize.y > 0 && textureSize.x > 0 && textureSize.y > 0)
+            layer.sprite.setScale(targetSize.x / textureSize.x, targetSize.y / textureSize.y);
+        layer.height = layer.sprite.getGlobalBounds().getSize().y;
+
+        m_layers.push_back(std::move(layer));
+    }
+
+    void Background::Update()
+    {
+        static const auto zone = GameUtils::Profiler::Instance().RegisterZone("Background");
+        GameUtils::ProfileScope scope(zone);
+        for(auto& layer : m_layers)
+        {
+            if(layer.scrollSpeed == 0.0f || layer.height <= 0.0f) continue;
+            layer.offset = std::fmod(layer.offset + layer.scrollSpeed, layer.height);
+            if(layer.offset < 0.0f) layer.offset += layer.height;
+        }
+    }
+
+    void Background::Snapshot(std::vector<SpriteSnapshot>& sprites) const
+    {
+        auto layerIndex = -static_cast<int>(m_layers.size());
+        for(const auto& layer : m_layers)
+        {
+            auto sprite = layer.sprite;
+            sprite.setPosition(0.0f, layer.offset);
+            sprites.push_back({sprite.getTexture(), sprite.getTextureRect(), sprite.getTransform(), sprite.getColor(), {0.0f, 0.0f}, layerIndex});
+            if(layer.offset != 0.0f)
+            {
+                sprite.setPosition(0.0f, layer.offset - layer.height);
+                sprites.push_back({sprite.getTexture(), sprite.getTextureRect(), sprite.getTransform(), sprite.getColor(), {0.0f, 0.0f}, layerIndex});
+            }
+            ++layerIndex;
+        }
+    }
+
+    void Background::Clear()
+    {
+        m_layers.clear();
+    }
+
+    std::size_t Background::GetLayerCount() const
+    {
+        return m_layers.size();
+    }
+
+    std::size_t Background::GetLoadCount() const
+    {
+        std::size_t loads = 0;
+        for(const auto& layer : m_layers)
+            loads += GameUtils::TextureCache::Instance().GetLoadCount(layer.texturePath);
+        return loads;
+    }
+}
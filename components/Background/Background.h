@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <vector>
+
+#include "SFML/Graphics.hpp"
+
+#include "TextureCache/TextureCache.h"
+#include "RenderThread/RenderSnapshot.h"
+
+namespace GameEngine
+{
+    struct BackgroundLayer
+    {
+        std::string texturePath;
+        std::shared_ptr<const sf::Texture> texture;
+        sf::Sprite sprite;
+        float scrollSpeed;
+        float offset;
+        float height;
+    };
+
+    class Background
+    {
+    public:
+        Background() = default;
+
+        // Layers are drawn in insertion order, a zero targetSize keeps the texture at its native size.
+        void AddLayer(const std::string& texturePath, const float& scrollSpeed = 0.0f, const sf::Vector2f& targetSize = {0.0f, 0.0f});
+        void Update();
+        // Appends the layers as they would be drawn, on negative layers so they stay behind every object
+        void Snapshot(std::vector<SpriteSnapshot>& sprites) const;
+        void Clear();
+        std::size_t GetLayerCount() const;
+        // Disk decodes of the layer textures, counted by the TextureCache. Stays at one per layer after startup.
+        std::size_t GetLoadCount() const;
+
+    private:
+        std::vector<BackgroundLayer> m_layers;
+    };
+}
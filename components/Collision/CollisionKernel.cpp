@@ -0,0 +1,107 @@
+#include <cstring>
+
+#include "CollisionKernel.h"
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define COLLISION_KERNEL_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define COLLISION_KERNEL_SSE2
+#endif
+
+namespace GameUtils
+{
+    void CircleTestBatchScalar(const int32_t* ax, const int32_t* ay, const int32_t* bx, const int32_t* by, const int32_t* radius, uint8_t* hits, const std::size_t& count)
+    {
+        for(std::size_t index = 0; index < count; ++index)
+        {
+            int64_t dx = static_cast<int64_t>(ax[index]) - bx[index];
+            int64_t dy = static_cast<int64_t>(ay[index]) - by[index];
+            int64_t r = radius[index];
+            hits[index] = (dx*dx + dy*dy <= r*r) ? 1 : 0;
+        }
+    }
+
+    void CircleTestBatch(const int32_t* ax, const int32_t* ay, const int32_t* bx, const int32_t* by, const int32_t* radius, uint8_t* hits, const std::size_t& count)
+    {
+        std::size_t index = 0;
+
+#if defined(COLLISION_KERNEL_AVX2)
+        // Distances are packed to int16 pairs (dx,dy) so a single madd yields dx*dx + dy*dy per lane
+        for(; index + 8 <= count; index += 8)
+        {
+            auto dx = _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ax + index)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bx + index)));
+            auto dy = _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ay + index)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(by + index)));
+            auto r = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(radius + index));
+
+            //Packing saturates, and two deltas saturated to -32768 would madd to INT_MIN and read as a hit
+            auto high = _mm256_set1_epi32(32767);
+            auto low = _mm256_set1_epi32(-32767);
+            auto outOfRange = _mm256_or_si256(_mm256_or_si256(_mm256_cmpgt_epi32(dx, high), _mm256_cmpgt_epi32(low, dx)),
+                _mm256_or_si256(_mm256_or_si256(_mm256_cmpgt_epi32(dy, high), _mm256_cmpgt_epi32(low, dy)), _mm256_or_si256(_mm256_cmpgt_epi32(r, high), _mm256_cmpgt_epi32(low, r))));
+            if(_mm256_movemask_epi8(outOfRange) != 0)
+            {
+                CircleTestBatchScalar(ax + index, ay + index, bx + index, by + index, radius + index, hits + index, 8);
+                continue;
+            }
+
+            auto delta = _mm256_unpacklo_epi16(_mm256_packs_epi32(dx, dx), _mm256_packs_epi32(dy, dy));
+            auto distance = _mm256_madd_epi16(delta, delta);
+            auto radiusPair = _mm256_unpacklo_epi16(_mm256_packs_epi32(r, r), _mm256_setzero_si256());
+            auto limit = _mm256_madd_epi16(radiusPair, radiusPair);
+
+            //Misses are all ones, narrowed to bytes and incremented they become 0 for a miss and 1 for a hit
+            auto miss = _mm256_cmpgt_epi32(distance, limit);
+            auto hitBytes = _mm256_add_epi8(_mm256_packs_epi16(_mm256_packs_epi32(miss, miss), miss), _mm256_set1_epi8(1));
+            auto lowHits = _mm_cvtsi128_si32(_mm256_castsi256_si128(hitBytes));
+            auto highHits = _mm_cvtsi128_si32(_mm256_extracti128_si256(hitBytes, 1));
+            std::memcpy(hits + index, &lowHits, sizeof(lowHits));
+            std::memcpy(hits + index + 4, &highHits, sizeof(highHits));
+        }
+#elif defined(COLLISION_KERNEL_SSE2)
+        // Distances are packed to int16 pairs (dx,dy) so a single madd yields dx*dx + dy*dy per lane
+        for(; index + 4 <= count; index += 4)
+        {
+            auto dx = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ax + index)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(bx + index)));
+            auto dy = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ay + index)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(by + index)));
+            auto r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(radius + index));
+
+            //Packing saturates, and two deltas saturated to -32768 would madd to INT_MIN and read as a hit
+            auto high = _mm_set1_epi32(32767);
+            auto low = _mm_set1_epi32(-32767);
+            auto outOfRange = _mm_or_si128(_mm_or_si128(_mm_cmpgt_epi32(dx, high), _mm_cmplt_epi32(dx, low)),
+                _mm_or_si128(_mm_or_si128(_mm_cmpgt_epi32(dy, high), _mm_cmplt_epi32(dy, low)), _mm_or_si128(_mm_cmpgt_epi32(r, high), _mm_cmplt_epi32(r, low))));
+            if(_mm_movemask_epi8(outOfRange) != 0)
+            {
+                CircleTestBatchScalar(ax + index, ay + index, bx + index, by + index, radius + index, hits + index, 4);
+                continue;
+            }
+
+            auto delta = _mm_unpacklo_epi16(_mm_packs_epi32(dx, dx), _mm_packs_epi32(dy, dy));
+            auto distance = _mm_madd_epi16(delta, delta);
+            auto radiusPair = _mm_unpacklo_epi16(_mm_packs_epi32(r, r), _mm_setzero_si128());
+            auto limit = _mm_madd_epi16(radiusPair, radiusPair);
+
+            //Misses are all ones, narrowed to bytes and incremented they become 0 for a miss and 1 for a hit
+            auto miss = _mm_cmpgt_epi32(distance, limit);
+            auto hitBytes = _mm_add_epi8(_mm_packs_epi16(_mm_packs_epi32(miss, miss), miss), _mm_set1_epi8(1));
+            auto laneHits = _mm_cvtsi128_si32(hitBytes);
+            std::memcpy(hits + index, &laneHits, sizeof(laneHits));
+        }
+#endif
+
+        CircleTestBatchScalar(ax + index, ay + index, bx + index, by + index, radius + index, hits + index, count - index);
+    }
+
+    const char* CollisionKernelName()
+    {
+#if defined(COLLISION_KERNEL_AVX2)
+        return "AVX2";
+#elif defined(COLLISION_KERNEL_SSE2)
+        return "SSE2";
+#else
+        return "Scalar";
+#endif
+    }
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace GameUtils
+{
+    // Narrow phase over a batch of candidate pairs stored as parallel arrays.
+    // hits[i] is set to 1 when (ax[i], ay[i]) lies within radius[i] of (bx[i], by[i]), 0 otherwise.
+    // The SIMD paths square 16 bit deltas, a group of pairs with a delta or radius outside +-32767 takes the scalar path instead.
+    void CircleTestBatch(const int32_t* ax, const int32_t* ay, const int32_t* bx, const int32_t* by, const int32_t* radius, uint8_t* hits, const std::size_t& count);
+    // Reference for CircleTestBatch, also used for the tail and out of range groups
+    void CircleTestBatchScalar(const int32_t* ax, const int32_t* ay, const int32_t* bx, const int32_t* by, const int32_t* radius, uint8_t* hits, const std::size_t& count);
+    // Instruction set CircleTestBatch was built with: "AVX2", "SSE2" or "Scalar"
+    const char* CollisionKernelName();
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "Object/Object.h"
+#include "Sound/Sound.h"
+
+namespace GameUtils
+{
+    constexpr int objectTypeCount = static_cast<int>(ObjectType::BOSS_PROJECTILE) + 1;
+
+    constexpr uint32_t TypeMask(const ObjectType& type)
+    {
+        return 1u << static_cast<int>(type);
+    }
+
+    template<typename... Types>
+    constexpr uint32_t TypeMask(const ObjectType& type, const Types&... types)
+    {
+        return TypeMask(type) | TypeMask(types...);
+    }
+
+    struct CollisionRule
+    {
+        uint32_t targetMask = 0;
+        SoundName hitSound = SoundName::ENEMY_DEATH;
+    };
+
+    // Row: type of the moving object, targetMask: types it hits
+    constexpr std::array<CollisionRule, objectTypeCount> collisionMatrix = {{
+        /* UNKNOWN          */ {0, SoundName::ENEMY_DEATH},
+        /* PLAYER           */ {0, SoundName::ENEMY_DEATH},
+        /* PROJECTILE       */ {TypeMask(ObjectType::ENEMY, ObjectType::BOSS), SoundName::ENEMY_DEATH},
+        /* ENEMY            */ {0, SoundName::ENEMY_DEATH},
+        /* ENEMY_PROJECTILE */ {TypeMask(ObjectType::PLAYER), SoundName::ENEMY_DEATH},
+        /* BOSS             */ {0, SoundName::ENEMY_DEATH},
+        /* BOSS_PROJECTILE  */ {TypeMask(ObjectType::PLAYER), SoundName::ENEMY_DEATH}
+    }};
+
+    constexpr const CollisionRule& CollisionRuleOf(const ObjectType& type)
+    {
+        return collisionMatrix[static_cast<int>(type)];
+    }
+
+    constexpr bool Collides(const ObjectType& source, const ObjectType& target)
+    {
+        return (CollisionRuleOf(source).targetMask & TypeMask(target)) != 0;
+    }
+
+    // Every type that appears as a target somewhere in the matrix
+    constexpr uint32_t CollisionTargetMask()
+    {
+        uint32_t mask = 0;
+        for(const auto& rule : collisionMatrix)
+            mask |= rule.targetMask;
+        return mask;
+    }
+}
@@ -0,0 +1,110 @@
+#include <optional>
+
+#include "CollisionSystem.h"
+
+namespace GameUtils
+{
+    void CollisionSystem::Resize(const sf::Vector2f& worldSize, const int& cellSize)
+    {
+        m_grid.Resize(worldSize, cellSize);
+    }
+
+    const std::vector<Contact>& CollisionSystem::Update(const ObjectStore& store, std::pmr::memory_resource* scratch)
+    {
+        const auto& columns = store.GetColumns();
+        m_grid.Rebuild(store, CollisionTargetMask());
+        m_contacts.clear();
+
+        //Sized from the previous tick so a bump allocator is not left with the abandoned halves of every growth step
+        std::optional<CandidatePairs> scratchPairs;
+        auto& pairs = scratch != nullptr ? scratchPairs.emplace(scratch) : m_fallbackPairs;
+        pairs.Clear();
+        pairs.Reserve(m_pairCount + m_pairCount / 4 + 16);
+
+        //Pair generation
+        for(uint32_t index = 0; index < columns.Size(); ++index)
+        {
+            if(!columns.alive[index]) continue;
+            const auto& rule = CollisionRuleOf(columns.type[index]);
+            if(rule.targetMask == 0) continue;
+
+            auto sourceHandle = store.GetHandle(index);
+            m_grid.Query(sf::Vector2i{columns.hitBoxX[index], columns.hitBoxY[index]}, rule.targetMask, [&](const SpatialGrid::Entry& entry)
+            {
+                auto target = entry.handle.index;
+                if(target == index) return;
+                pairs.sourceX.push_back(columns.hitBoxX[index]);
+                pairs.sourceY.push_back(columns.hitBoxY[index]);
+                pairs.targetX.push_back(columns.hitBoxX[target]);
+                pairs.targetY.push_back(columns.hitBoxY[target]);
+                pairs.radius.push_back(columns.hitBoxWidth[target]);
+                pairs.contacts.push_back(Contact{sourceHandle, entry.handle, columns.type[index], entry.type});
+            });
+        }
+
+        //Narrow phase
+        m_pairCount = pairs.Size();
+        std::optional<std::pmr::vector<uint8_t>> scratchHits;
+        auto& hits = scratch != nullptr ? scratchHits.emplace(scratch) : m_fallbackHits;
+        hits.resize(m_pairCount);
+        CircleTestBatch(pairs.sourceX.data(), pairs.sourceY.data(), pairs.targetX.data(), pairs.targetY.data(), pairs.radius.data(), hits.data(), m_pairCount);
+        for(std::size_t pair = 0; pair < m_pairCount; ++pair)
+        {
+            if(hits[pair])
+                m_contacts.push_back(pairs.contacts[pair]);
+        }
+        return m_contacts;
+    }
+
+    void CollisionSystem::Clear()
+    {
+        m_grid.Clear();
+        m_contacts.clear();
+        m_pairCount = 0;
+    }
+
+    const std::vector<Contact>& CollisionSystem::GetContacts() const
+    {
+        return m_contacts;
+    }
+
+    const SpatialGrid& CollisionSystem::GetGrid() const
+    {
+        return m_grid;
+    }
+
+    std::size_t CollisionSystem::GetPairCount() const
+    {
+        return m_pairCount;
+    }
+
+    CollisionSystem::CandidatePairs::CandidatePairs(std::pmr::memory_resource* resource) :
+        sourceX(resource), sourceY(resource), targetX(resource), targetY(resource), radius(resource), contacts(resource)
+    {
+    }
+
+    void CollisionSystem::CandidatePairs::Reserve(const std::size_t& pairs)
+    {
+        sourceX.reserve(pairs);
+        sourceY.reserve(pairs);
+        targetX.reserve(pairs);
+        targetY.reserve(pairs);
+        radius.reserve(pairs);
+        contacts.reserve(pairs);
+    }
+
+    void CollisionSystem::CandidatePairs::Clear()
+    {
+        sourceX.clear();
+        sourceY.clear();
+        targetX.clear();
+        targetY.clear();
+        radius.clear();
+        contacts.clear();
+    }
+
+        std::size_t CollisionSystem::CandidatePairs::Size() const
+    {
+        return contacts.size();
+    }
+}
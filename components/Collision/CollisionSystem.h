@@ -0,0 +1,63 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <memory_resource>
+
+#include "SFML/Graphics.hpp"
+
+#include "ObjectStore/ObjectStore.h"
+#include "CollisionLayers.h"
+#include "CollisionKernel.h"
+#include "SpatialGrid.h"
+
+namespace GameUtils
+{
+    struct Contact
+    {
+        ObjectHandle source;
+        ObjectHandle target;
+        ObjectType sourceType;
+        ObjectType targetType;
+    };
+
+    // Broad phase, pair generation from the collision matrix and batched narrow phase, run once per tick.
+    class CollisionSystem
+    {
+    public:
+        CollisionSystem() = default;
+
+        void Resize(const sf::Vector2f& worldSize, const int& cellSize = 64);
+        // Candidate pairs and narrow phase results only live during the call and are allocated from scratch,
+        // normally the frame arena. Without scratch the system reuses its own buffers, they keep their capacity
+        // between calls. The returned contacts stay valid until the next Update or Clear.
+        const std::vector<Contact>& Update(const ObjectStore& store, std::pmr::memory_resource* scratch = nullptr);
+        void Clear();
+        const std::vector<Contact>& GetContacts() const;
+        const SpatialGrid& GetGrid() const;
+        std::size_t GetPairCount() const;
+
+    private:
+        struct CandidatePairs
+        {
+            explicit CandidatePairs(std::pmr::memory_resource* resource);
+
+            std::pmr::vector<int32_t> sourceX;
+            std::pmr::vector<int32_t> sourceY;
+            std::pmr::vector<int32_t> targetX;
+            std::pmr::vector<int32_t> targetY;
+            std::pmr::vector<int32_t> radius;
+            std::pmr::vector<Contact> contacts;
+
+            void Reserve(const std::size_t& pairs);
+            void Clear();
+            std::size_t Size() const;
+        };
+
+        SpatialGrid m_grid;
+        std::vector<Contact> m_contacts;
+        std::size_t m_pairCount = 0;
+        CandidatePairs m_fallbackPairs{std::pmr::new_delete_resource()};
+        std::pmr::vector<uint8_t> m_fallbackHits{std::pmr::new_delete_resource()};
+    };
+}
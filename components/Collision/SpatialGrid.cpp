@@ -0,0 +1,68 @@
+#include <cmath>
+
+#include "SpatialGrid.h"
+
+namespace GameUtils
+{
+    void SpatialGrid::Resize(const sf::Vector2f& worldSize, const int& cellSize)
+    {
+        m_cellSize = std::max(cellSize, 1);
+        m_columns = std::max(static_cast<int>(std::ceil(worldSize.x / m_cellSize)), 1);
+        m_rows = std::max(static_cast<int>(std::ceil(worldSize.y / m_cellSize)), 1);
+        m_cellStart.assign(m_columns * m_rows + 1, 0);
+        m_cellMask.assign(m_columns * m_rows, 0);
+        m_entries.clear();
+    }
+
+    void SpatialGrid::Rebuild(const ObjectStore& store, const uint32_t& insertMask)
+    {
+        const auto& columns = store.GetColumns();
+        auto cellCount = m_columns * m_rows;
+        std::fill(m_cellStart.begin(), m_cellStart.end(), 0);
+        std::fill(m_cellMask.begin(), m_cellMask.end(), 0);
+        m_entryCells.assign(columns.Size(), 0);
+        m_maxExtent = 0;
+        m_maxSpeed = 0;
+
+        //Counting pass
+        auto entryCount = 0u;
+        for(uint32_t index = 0; index < columns.Size(); ++index)
+        {
+            if(!columns.alive[index] || (TypeMask(columns.type[index]) & insertMask) == 0) continue;
+            auto cell = CellRow(columns.hitBoxY[index]) * m_columns + CellColumn(columns.hitBoxX[index]);
+            m_entryCells[index] = cell;
+            ++m_cellStart[cell + 1];
+            m_cellMask[cell] |= TypeMask(columns.type[index]);
+            m_maxExtent = std::max({m_maxExtent, columns.hitBoxWidth[index], columns.hitBoxHeight[index]});
+            m_maxSpeed = std::max({m_maxSpeed, static_cast<int>(std::ceil(std::abs(columns.velocityX[index]))), static_cast<int>(std::ceil(std::abs(columns.velocityY[index])))});
+            ++entryCount;
+        }
+
+        for(auto cell = 0; cell < cellCount; ++cell)
+            m_cellStart[cell + 1] += m_cellStart[cell];
+
+        //Scatter pass, m_cellStart is used as the write cursor and shifted back afterwards
+        m_entries.resize(entryCount);
+        for(uint32_t index = 0; index < columns.Size(); ++index)
+        {
+            if(!columns.alive[index] || (TypeMask(columns.type[index]) & insertMask) == 0) continue;
+            auto cell = m_entryCells[index];
+            m_entries[m_cellStart[cell]++] = Entry{store.GetHandle(index), columns.type[index]};
+        }
+        for(auto cell = cellCount; cell > 0; --cell)
+            m_cellStart[cell] = m_cellStart[cell - 1];
+        m_cellStart[0] = 0;
+    }
+
+    void SpatialGrid::Clear()
+    {
+        std::fill(m_cellStart.begin(), m_cellStart.end(), 0);
+        std::fill(m_cellMask.begin(), m_cellMask.end(), 0);
+        m_entries.clear();
+    }
+
+    std::size_t SpatialGrid::GetEntryCount() const
+    {
+        return m_entries.size();
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include "SFML/Graphics.hpp"
+
+#include "Object/Object.h"
+#include "ObjectStore/ObjectStore.h"
+#include "CollisionLayers.h"
+
+namespace GameUtils
+{
+    // Uniform grid broad phase rebuilt from the entity columns once per tick.
+    // Objects are binned by the top-left corner of their hitbox, queries widen by the largest hitbox and speed seen.
+    class SpatialGrid
+    {
+    public:
+        struct Entry
+        {
+            ObjectHandle handle;
+            ObjectType type;
+        };
+
+        SpatialGrid() = default;
+
+        void Resize(const sf::Vector2f& worldSize, const int& cellSize = 64);
+        // Only objects whose type is in insertMask are binned.
+        void Rebuild(const ObjectStore& store, const uint32_t& insertMask);
+        void Clear();
+        std::size_t GetEntryCount() const;
+
+        // Calls callback(const Entry&) for every binned object of a type in typeMask close enough to point to collide.
+        template<typename Callback>
+        void Query(const sf::Vector2i& point, const uint32_t& typeMask, Callback&& callback) const
+        {
+            if(m_columns == 0 || m_rows == 0) return;
+            auto reach = m_maxExtent + m_maxSpeed;
+            auto firstColumn = CellColumn(point.x - reach), lastColumn = CellColumn(point.x + reach);
+            auto firstRow = CellRow(point.y - reach), lastRow = CellRow(point.y + reach);
+
+            for(auto row = firstRow; row <= lastRow; ++row)
+            {
+                for(auto column = firstColumn; column <= lastColumn; ++column)
+                {
+                    auto cell = row * m_columns + column;
+                    if((m_cellMask[cell] & typeMask) == 0) continue;
+                    for(auto entry = m_cellStart[cell]; entry < m_cellStart[cell + 1]; ++entry)
+                    {
+                        if(TypeMask(m_entries[entry].type) & typeMask)
+                            callback(m_entries[entry]);
+                    }
+                }
+            }
+        }
+
+    private:
+        int m_cellSize = 64;
+        int m_columns = 0;
+        int m_rows = 0;
+        int m_maxExtent = 0;
+        int m_maxSpeed = 0;
+        std::vector<uint32_t> m_cellStart;
+        std::vector<uint32_t> m_cellMask;
+        std::vector<Entry> m_entries;
+        std::vector<uint32_t> m_entryCells;
+
+        int CellColumn(const int& x) const
+        {
+            return std::clamp(x / m_cellSize - (x < 0 ? 1 : 0), 0, m_columns - 1);
+        }
+
+        int CellRow(const int& y) const
+        {
+            return std::clamp(y / m_cellSize - (y < 0 ? 1 : 0), 0, m_rows - 1);
+        }
+    };
+}
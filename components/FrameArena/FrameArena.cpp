@@ -0,0 +1,58 @@
+#include <algorithm>
+
+#include "FrameArena.h"
+
+namespace GameUtils
+{
+    FrameArena::FrameArena(const std::size_t& capacity, std::pmr::memory_resource* upstream) :
+        m_buffer(std::make_unique<std::byte[]>(capacity)), m_capacity(capacity), m_upstream(upstream)
+    {
+        m_stats.capacity = capacity;
+    }
+
+    void FrameArena::Reset()
+    {
+        m_stats.lastTickBytes = m_used;
+        m_used = 0;
+    }
+
+    bool FrameArena::Owns(const void* memory) const
+    {
+        auto address = static_cast<const std::byte*>(memory);
+        return address >= m_buffer.get() && address < m_buffer.get() + m_capacity;
+    }
+
+    FrameArenaStats FrameArena::GetStats() const
+    {
+        return m_stats;
+    }
+
+    void* FrameArena::do_allocate(std::size_t bytes, std::size_t alignment)
+    {
+        auto address = reinterpret_cast<std::uintptr_t>(m_buffer.get()) + m_used;
+        auto padding = (alignment - address % alignment) % alignment;
+        if(padding + bytes <= m_capacity - m_used)
+        {
+            auto memory = m_buffer.get() + m_used + padding;
+            m_used += padding + bytes;
+            m_stats.highWaterBytes = std::max(m_stats.highWaterBytes, m_used);
+            return memory;
+        }
+
+        ++m_stats.fallbacks;
+        m_stats.fallbackBytes += bytes;
+        return m_upstream->allocate(bytes, alignment);
+    }
+
+    void FrameArena::do_deallocate(void* memory, std::size_t bytes, std::size_t alignment)
+    {
+        //Arena memory is only given back by Reset
+        if(Owns(memory)) return;
+        m_upstream->deallocate(memory, bytes, alignment);
+    }
+
+    bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+    {
+        return this == &other;
+    }
+}
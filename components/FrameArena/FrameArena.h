@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace GameUtils
+{
+    struct FrameArenaStats
+    {
+        std::size_t capacity = 0;
+        // Bytes bumped by the tick before the last Reset
+        std::size_t lastTickBytes = 0;
+        std::size_t highWaterBytes = 0;
+        // Allocations that did not fit and went to the upstream resource instead
+        uint64_t fallbacks = 0;
+        uint64_t fallbackBytes = 0;
+    };
+
+    // Bump allocator for data that lives for one simulation tick. Containers draw from it through the
+    // std::pmr interface, deallocation of arena memory is a no-op and everything is released at once by Reset.
+    // Containers using it must not outlive the tick. Not thread safe, owned by the simulation thread.
+    class FrameArena : public std::pmr::memory_resource
+    {
+    public:
+        static constexpr std::size_t defaultCapacity = 256 * 1024;
+
+        explicit FrameArena(const std::size_t& capacity = defaultCapacity, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        // Tick boundary: every allocation made since the previous Reset becomes invalid
+        void Reset();
+        bool Owns(const void* memory) const;
+        FrameArenaStats GetStats() const;
+
+    private:
+        std::unique_ptr<std::byte[]> m_buffer;
+        std::size_t m_capacity = 0;
+        std::size_t m_used = 0;
+        std::pmr::memory_resource* m_upstream = nullptr;
+        FrameArenaStats m_stats;
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void* memory, std::size_t bytes, std::size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+    };
+}
@@ -0,0 +1,110 @@
+#include <cmath>
+#include <thread>
+#include <algorithm>
+
+#include "SFML/System.hpp"
+
+#include "FramePacer.h"
+
+namespace GameEngine
+{
+    FramePacer::FramePacer(const std::chrono::nanoseconds& interval) :
+        m_interval(interval), m_deadline(std::chrono::steady_clock::now() + interval), m_lastFrame(std::chrono::steady_clock::now())
+    {}
+
+    void FramePacer::SetInterval(const std::chrono::nanoseconds& interval)
+    {
+        m_interval = interval;
+    }
+
+    void FramePacer::SetIdleInterval(const std::chrono::nanoseconds& interval)
+    {
+        m_idleInterval = interval;
+    }
+
+    void FramePacer::SetSpinThreshold(const std::chrono::nanoseconds& threshold)
+    {
+        m_spinThreshold = threshold;
+    }
+
+    void FramePacer::SetMode(const PacingMode& mode)
+    {
+        m_mode = mode;
+    }
+
+    void FramePacer::SetIdle(const bool& idle)
+    {
+        m_idle = idle;
+    }
+
+    PacingMode FramePacer::GetMode() const
+    {
+        return m_mode;
+    }
+
+    void FramePacer::WaitForNextFrame()
+    {
+        auto now = std::chrono::steady_clock::now();
+        auto interval = m_idle ? m_idleInterval : m_interval;
+
+        //Display swap already blocked on the vertical blank
+        if(m_mode == PacingMode::VSYNC && !m_idle)
+        {
+            m_deadline = now + interval;
+            Record(now);
+            return;
+        }
+
+        //Missed deadlines restart the schedule instead of bursting frames to catch up
+        if(m_deadline < now - interval)
+            m_deadline = now;
+
+        auto remaining = m_deadline - now;
+        if(remaining > m_spinThreshold)
+        {
+            auto sleepStart = std::chrono::steady_clock::now();
+            sf::sleep(sf::microseconds(std::chrono::duration_cast<std::chrono::microseconds>(remaining - m_spinThreshold).count()));
+            m_sleptThisFrame += std::chrono::steady_clock::now() - sleepStart;
+        }
+        while(std::chrono::steady_clock::now() < m_deadline)
+            std::this_thread::yield();
+
+        now = std::chrono::steady_clock::now();
+        m_deadline += interval;
+        Record(now);
+    }
+
+    FramePacerStats FramePacer::GetStats() const
+    {
+        FramePacerStats stats;
+        if(m_historyCount == 0) return stats;
+
+        auto frameSum = 0.0, awakeSum = 0.0;
+        for(std::size_t index = 0; index < m_historyCount; ++index)
+        {
+            frameSum += m_frameHistory[index];
+            awakeSum += m_awakeHistory[index];
+            stats.worstFrameMs = std::max(stats.worstFrameMs, m_frameHistory[index]);
+        }
+        stats.averageFrameMs = frameSum / m_historyCount;
+
+        auto variance = 0.0;
+        for(std::size_t index = 0; index < m_historyCount; ++index)
+            variance += (m_frameHistory[index] - stats.averageFrameMs) * (m_frameHistory[index] - stats.averageFrameMs);
+        stats.jitterMs = std::sqrt(variance / m_historyCount);
+        stats.cpuUtilization = (frameSum > 0.0) ? awakeSum / frameSum : 0.0;
+        return stats;
+    }
+
+    void FramePacer::Record(const std::chrono::steady_clock::time_point& now)
+    {
+        auto frameMs = std::chrono::duration<double, std::milli>(now - m_lastFrame).count();
+        auto sleptMs = std::chrono::duration<double, std::milli>(m_sleptThisFrame).count();
+        m_frameHistory[m_historyHead] = frameMs;
+        m_awakeHistory[m_historyHead] = std::max(frameMs - sleptMs, 0.0);
+        m_historyHead = (m_historyHead + 1) % historySize;
+        m_historyCount = std::min(m_historyCount + 1, historySize);
+        m_sleptThisFrame = std::chrono::nanoseconds(0);
+        m_lastFrame = now;
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+
+#include "GameUtils/GameUtils.h"
+
+namespace GameEngine
+{
+    enum class PacingMode : int
+    {
+        PRECISE = 0,
+        VSYNC
+    };
+
+    struct FramePacerStats
+    {
+        double averageFrameMs = 0.0;
+        double jitterMs = 0.0;
+        double worstFrameMs = 0.0;
+        // Share of wall time the calling thread spent awake (working or spinning) rather than asleep
+        double cpuUtilization = 0.0;
+    };
+
+    // Sleeps for the bulk of each frame interval and spins only for the last spinThreshold.
+    class FramePacer
+    {
+    public:
+        explicit FramePacer(const std::chrono::nanoseconds& interval = GameUtils::renderFrametime);
+
+        void SetInterval(const std::chrono::nanoseconds& interval);
+        void SetIdleInterval(const std::chrono::nanoseconds& interval);
+        void SetSpinThreshold(const std::chrono::nanoseconds& threshold);
+        void SetMode(const PacingMode& mode);
+        // Idle frames (menu, pause) run at the idle interval, in both modes
+        void SetIdle(const bool& idle);
+        PacingMode GetMode() const;
+
+        void WaitForNextFrame();
+        FramePacerStats GetStats() const;
+
+    private:
+        static constexpr std::size_t historySize = 128;
+
+        PacingMode m_mode = PacingMode::PRECISE;
+        bool m_idle = false;
+        std::chrono::nanoseconds m_interval;
+        std::chrono::nanoseconds m_idleInterval = 50ms;
+        std::chrono::nanoseconds m_spinThreshold = 1ms;
+        std::chrono::steady_clock::time_point m_deadline;
+        std::chrono::steady_clock::time_point m_lastFrame;
+
+        std::array<double, historySize> m_frameHistory{};
+        std::array<double, historySize> m_awakeHistory{};
+        std::size_t m_historyHead = 0;
+        std::size_t m_historyCount = 0;
+        std::chrono::nanoseconds m_sleptThisFrame{0};
+
+        void Record(const std::chrono::steady_clock::time_point& now);
+    };
+}
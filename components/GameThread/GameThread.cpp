@@ -12,28 +12,43 @@ using namespace std::chrono_literals;
 
 namespace GameEngine
 {
+    namespace
+    {
+        //One zone per object type, logic handlers are told apart by the type they drive
+        GameUtils::ZoneId LogicZone(const GameUtils::ObjectType& type)
+        {
+            static const auto zones = []()
+            {
+                std::array<GameUtils::ZoneId, GameUtils::objectTypeCount> ids;
+                for(auto index = 0; index < GameUtils::objectTypeCount; ++index)
+                {
+                    auto name = GameUtils::ObjectTypeToString(static_cast<GameUtils::ObjectType>(index));
+                    ids[index] = GameUtils::Profiler::Instance().RegisterZone("Logic/" + (name.empty() ? std::string("Unknown") : name));
+                }
+                return ids;
+            }();
+            return zones[static_cast<std::size_t>(type)];
+        }
+    }
+
     GameThread::GameThread(const std::shared_ptr<sf::RenderWindow>& window) :
-        m_window(std::move(window))
+        m_window(std::move(window)), m_viewportSize(m_window->getDefaultView().getSize())
     {
-        m_logicFunction = std::make_shared<LogicFunctions>(std::shared_ptr<GameThread>(this));
-        InitializeState();
-        MenuScreen(); 
-        RenderText();
-        RenderStage();
-        ClearScreen();
+        GameUtils::TextureCache::Configure(GameUtils::TextureCacheConfig{});
+        Startup();
+    }
 
-        m_lastFrameTime = std::chrono::steady_clock::now();
+    GameThread::GameThread(const sf::Vector2f& viewportSize) :
+        m_viewportSize(viewportSize)
+    {
+        GameUtils::TextureCache::Configure(GameUtils::TextureCacheConfig{true});
+        Startup();
     }
 
     GameThread::~GameThread()
     {        
-        for(auto soundFile : GameUtils::soundFiles)
-        {
-            m_generalSoundChannels[soundFile].second.stop();
-            while(m_generalSoundChannels[soundFile].second.getStatus() != sf::Sound::Stopped);
-            m_generalSoundChannels[soundFile].first.reset();
-        }
-        m_generalSoundChannels.clear();
+        if(m_voicePool != nullptr)
+            m_voicePool->StopAll();
     }
 
     std::shared_ptr<sf::RenderWindow> GameThread::GetRenderWindow()
@@ -41,18 +56,44 @@ namespace GameEngine
         return m_window;
     }
 
-    std::vector<GameUtils::Object>& GameThread::GetObjects()
+    sf::Vector2f GameThread::GetViewportSize()
+    {
+        return m_viewportSize;
+    }
+
+    bool GameThread::IsHeadless()
+    {
+        return m_window == nullptr;
+    }
+
+    void GameThread::Startup()
+    {
+        //LogicFunctions only borrows the game thread, it must not delete it
+        m_logicFunction = std::make_shared<LogicFunctions>(std::shared_ptr<GameThread>(this, [](GameThread*){}));
+        InitializeState();
+        m_logicFunction->RegisterProjectiles(m_projectilePool);
+        MenuScreen(); 
+        RenderText();
+        RenderStage();
+        PublishSnapshot();
+    }
+
+    GameUtils::ObjectStore& GameThread::GetObjects()
     {
         return m_objects;
     }
 
+    const GameUtils::WorldQuery& GameThread::GetWorld()
+    {
+        return m_objects.GetWorld();
+    }
+
     GameUtils::Object& GameThread::CreateObject(const std::string& id , const GameUtils::ObjectType& objType, 
             const std::string& texturePath, const std::string& soundPath,
             const std::function<void(GameUtils::Object&)>& startupHandler, const std::function<void(GameUtils::Object&)>& logicHandler, 
             const std::chrono::milliseconds& animationFrametime, const int& hitPoints, const int& scorePoint)
     {
-        m_objects.emplace_back(id, objType, texturePath, soundPath, startupHandler, logicHandler, animationFrametime, hitPoints, scorePoint);
-        return m_objects.back();
+        return m_objects.Create(id, objType, texturePath, soundPath, startupHandler, logicHandler, animationFrametime, hitPoints, scorePoint);
     }
 
     GameUtils::Object& GameThread::CreateObjectAnimated(const std::string& id, const GameUtils::ObjectType& objType, 
@@ -60,25 +101,30 @@ namespace GameEngine
             const std::function<void(GameUtils::Object&)>& startupHandler, const std::function<void(GameUtils::Object&)>& logicHandler, 
             const std::chrono::milliseconds& animationFrametime, const int& hitPoints, const int& scorePoint, const int& textureRow, const bool& isLoop) 
     {
-        m_objects.emplace_back(id, objType, texturePath, soundPath, startupHandler, logicHandler, animationFrametime, hitPoints, scorePoint);
-        m_objects.back().SetupAnimatedAction(textureRow, isLoop);
-        return m_objects.back();
+        auto& obj = m_objects.Create(id, objType, texturePath, soundPath, startupHandler, logicHandler, animationFrametime, hitPoints, scorePoint);
+        obj.SetupAnimatedAction(textureRow, isLoop);
+        return obj;
+    }
+
+    ProjectilePool& GameThread::GetProjectilePool()
+    {
+        return m_projectilePool;
     }
 
     void GameThread::DestroyObject(const GameUtils::Object& obj)
     {
-        m_objects.erase(std::find(m_objects.begin(), m_objects.end(), obj));
+        m_objects.Destroy(obj.GetHandle());
     }
 
     void GameThread::DestroyObjectAnimated(const GameUtils::Object& obj, const int& textureRow)
     {
-        auto objIterator = std::find(m_objects.begin(), m_objects.end(), obj);
-        objIterator->SetupAnimatedAction(textureRow, false, true);
+        if(auto objPtr = m_objects.Get(obj.GetHandle()); objPtr != nullptr)
+            objPtr->SetupAnimatedAction(textureRow, false, true);
     }
 
-    std::unordered_map<sf::Keyboard::Scancode, std::shared_ptr<GameUtils::Input>>& GameThread::GetKeys()
+    GameUtils::InputState& GameThread::GetInput()
     {
-        return m_keyMaps;
+        return m_input;
     }
 
     int& GameThread::GetScore()
@@ -91,18 +137,30 @@ namespace GameEngine
         m_score = score;
         if(m_score > m_highscore)
             m_highscore = m_score;
+        if(IsHeadless()) return;
         m_textSprites[GameUtils::TextType::SCORE].setString("Score: " + std::to_string(m_score));
         m_textSprites[GameUtils::TextType::HIGH_SCORE].setString("Highscore: " + std::to_string(m_highscore));
     }
 
     void GameThread::InitializeState()
     {
+        m_collisionSystem.Resize(m_viewportSize);
+        m_input.Clear();
+        if(IsHeadless()) return;
+
+        //Held keys are tracked as levels, repeated presses would only flood the event ring
+        m_window->setKeyRepeatEnabled(false);
+
         m_font.loadFromFile("../resources/fonts/PressStart2P-vaV7.ttf");
+        m_overlay.Bake(m_font, 8);
+        GameUtils::TextureAtlas::Instance().Load(GameUtils::atlasTablePath);
+        m_logicFunction->PrewarmVariants();
+        m_window->setVerticalSyncEnabled(GameUtils::useVerticalSync);
+        m_renderThread.GetFramePacer().SetMode(GameUtils::useVerticalSync ? PacingMode::VSYNC : PacingMode::PRECISE);
+        m_renderThread.GetFramePacer().SetIdleInterval(GameUtils::idleFrametime);
+        m_background.AddLayer("../resources/texture/background.png", 0.0f, m_viewportSize);
 
         GenerateSoundChannels();
-
-        for(auto& key : GameUtils::Keyboard_Keys)
-            m_keyMaps[key] = std::make_shared<GameUtils::Input>(key);
     }
 
     void GameThread::RenderStage()
@@ -111,7 +169,7 @@ namespace GameEngine
         m_progression = GameUtils::Progression::NORMAL_GAME;
 
         RenderText();
-        auto windowSize = m_window->getDefaultView().getSize();
+        auto windowSize = m_viewportSize;
   
         //Putting Player ship on the rendering pipeline
         CreateObject("0",GameUtils::ObjectType::PLAYER, "../resources/texture/multi-anim-ship.png", "",
@@ -132,53 +190,123 @@ namespace GameEngine
 
     void GameThread::MenuScreen()
     {
+        m_progression = GameUtils::Progression::MENU;
+        if(IsHeadless()) return;
+
+        auto viewCenter = m_viewportSize / 2.0f;
         std::string menuTitleString = "SPACE INVADERS";
         auto menuTitleSize = 50;
         m_textSprites[GameUtils::TextType::MENU_TITLE] = {menuTitleString, m_font, menuTitleSize};
-        m_textSprites[GameUtils::TextType::MENU_TITLE].setPosition({m_window->getDefaultView().getCenter().x - (menuTitleString.size()/2)*menuTitleSize, m_window->getDefaultView().getCenter().y/2});
+        m_textSprites[GameUtils::TextType::MENU_TITLE].setPosition({viewCenter.x - (menuTitleString.size()/2)*menuTitleSize, viewCenter.y/2});
         m_textSprites[GameUtils::TextType::MENU_TITLE].setFillColor(sf::Color(GameUtils::red));
 
         std::string menuStartString = "PRESS ENTER TO START";
         auto menuStartSize = 24;
         m_textSprites[GameUtils::TextType::MENU_START] = {menuStartString, m_font, menuStartSize};
-        m_textSprites[GameUtils::TextType::MENU_START].setPosition({m_window->getDefaultView().getCenter().x - (menuStartString.size()/2)*menuStartSize, 3*m_window->getDefaultView().getCenter().y/2});
+        m_textSprites[GameUtils::TextType::MENU_START].setPosition({viewCenter.x - (menuStartString.size()/2)*menuStartSize, 3*viewCenter.y/2});
         m_textSprites[GameUtils::TextType::MENU_START].setFillColor(sf::Color(GameUtils::red));
-
-        m_progression = GameUtils::Progression::MENU;
     }
     
-    void GameThread::DrawSprites()
+    void GameThread::PublishSnapshot()
+    {
+        static const auto zone = GameUtils::Profiler::Instance().RegisterZone("PublishSnapshot");
+        GameUtils::ProfileScope scope(zone);
+        if(IsHeadless()) return;
+        auto& snapshot = m_renderThread.BeginSnapshot();
+        snapshot.tick = GameUtils::GetCurrentTick();
+        snapshot.interpolate = m_interpolate;
+        snapshot.idle = m_progression == GameUtils::Progression::MENU || m_progression == GameUtils::Progression::PAUSE || m_progression == GameUtils::Progression::GAME_OVER;
+        m_background.Snapshot(snapshot.sprites);
+
+        //Sprites keep only their local transform, the world position is taken from the columns
+        const auto& columns = m_objects.GetColumns();
+        for(auto& obj : m_objects)
+        {
+            const auto& sprite = obj.GetSprite();
+            auto index = obj.GetHandle().index;
+            auto velocity = sf::Vector2f{columns.velocityX[index], columns.velocityY[index]};
+            if(std::abs(velocity.x) > maxInterpolatedStep || std::abs(velocity.y) > maxInterpolatedStep)
+                velocity = {0.0f, 0.0f};
+            sf::Transform transform;
+            transform.translate(columns.positionX[index], columns.positionY[index]).combine(sprite.getTransform());
+            snapshot.sprites.push_back({sprite.getTexture(), sprite.getTextureRect(), transform, sprite.getColor(), velocity, 0});
+        }
+
+        snapshot.texts.resize(m_textSprites.size());
+        auto text = snapshot.texts.begin();
+        for(const auto& [_, textSprite] : m_textSprites)
+            *text++ = textSprite;
+
+        auto renderStats = m_renderThread.GetStats();
+        PerfOverlaySample sample;
+        sample.frameMs = renderStats.frameMs;
+        sample.simulationTickMs = m_simulationTickMs;
+        sample.renderMs = renderStats.renderMs;
+        sample.snapshotLatencyMs = renderStats.snapshotLatencyMs;
+        sample.pacer = GetFramePacerStats();
+        sample.render = renderStats.batch;
+        sample.tickAllocations = GameUtils::AllocationTracker::Instance().GetTickStats().lastTick;
+        sample.frameArena = m_frameArena.GetStats();
+        sample.textureHits = GameUtils::TextureCache::Instance().GetHits();
+        sample.textureMisses = GameUtils::TextureCache::Instance().GetMisses();
+        sample.backgroundLoads = m_background.GetLoadCount();
+        sample.audio = GetAudioStats();
+        for(auto type = 0; type < GameUtils::objectTypeCount; ++type)
+            sample.objectCounts[type] = m_objects.GetWorld().Count(static_cast<GameUtils::ObjectType>(type));
+        m_overlay.Sample(sample);
+        m_overlay.AppendTo(snapshot.sprites, m_viewportSize);
+
+        m_renderThread.Publish();
+    }
+
+    SpriteBatchStats GameThread::GetRenderStats() const
+    {
+        return m_renderThread.GetStats().batch;
+    }
+
+    PipelineStats GameThread::GetPipelineStats() const
+    {
+        auto renderStats = m_renderThread.GetStats();
+        return {m_simulationTickMs, renderStats.renderMs, renderStats.snapshotLatencyMs};
+    }
+
+    GameUtils::FrameArenaStats GameThread::GetFrameArenaStats() const
     {
-        for(auto& sprite : m_objects)
-            m_window->draw(sprite.GetSprite());
-        for(auto& [_, text] : m_textSprites)
-            m_window->draw(text);
+        return m_frameArena.GetStats();
     }
 
     void GameThread::CaptureKeyInput()
     {
-        if(m_window->pollEvent(m_keyboardEvent))
+        static const auto zone = GameUtils::Profiler::Instance().RegisterZone("CaptureKeyInput");
+        GameUtils::ProfileScope scope(zone);
+        if(IsHeadless()) return;
+        //Drains every pending event so a burst of key changes never spills into later ticks
+        auto tick = GameUtils::GetCurrentTick();
+        while(m_window->pollEvent(m_keyboardEvent))
         {
-            if(m_keyboardEvent.type == sf::Event::Closed)
-                m_window->close();
-
             switch(m_keyboardEvent.type)
             {
-                case sf::Event::EventType::KeyPressed:
-                        if(m_keyMaps[m_keyboardEvent.key.scancode] != nullptr)
-                            m_keyMaps[m_keyboardEvent.key.scancode]->SetPressed(true);
+                case sf::Event::EventType::Closed:
+                        m_closeRequested = true;
                         break;
+                case sf::Event::EventType::KeyPressed:
                 case sf::Event::EventType::KeyReleased:
-                        if(m_keyMaps[m_keyboardEvent.key.scancode] != nullptr)
-                            m_keyMaps[m_keyboardEvent.key.scancode]->SetPressed(false);
-                        break;       
-            }       
+                        m_input.Push({m_keyboardEvent.key.scancode, m_keyboardEvent.type == sf::Event::EventType::KeyPressed, std::chrono::steady_clock::now(), tick});
+                        break;
+                default:
+                        break;
+            }
         }
+        //The overlay is display only, its toggle is kept out of SimulationInput and replays
+        if(m_input.WasPressed(sf::Keyboard::Scancode::F3))
+            m_overlay.Toggle();
     }
 
     void GameThread::PauseLogic()
     {
-        if(m_keyMaps[sf::Keyboard::Scancode::Enter] != nullptr && m_keyMaps[sf::Keyboard::Scancode::Enter]->GetPressed())
+        static const auto zone = GameUtils::Profiler::Instance().RegisterZone("PauseLogic");
+        GameUtils::ProfileScope scope(zone);
+        if(m_input.IsActive(sf::Keyboard::Scancode::Enter))
         {
             if(m_progression == GameUtils::Progression::GAME_OVER)
             {
@@ -195,12 +323,12 @@ namespace GameEngine
             }
         }
         
-        if((m_paused == 0 || m_paused == 2) && m_keyMaps[sf::Keyboard::Scancode::P]->GetPressed())
+        if((m_paused == 0 || m_paused == 2) && m_input.IsActive(sf::Keyboard::Scancode::P))
         {
             m_paused = (m_paused + 1) % 4;
             m_textSprites.erase(GameUtils::TextType::PAUSE);
         }
-        else if((m_paused == 1 || m_paused == 3) && !m_keyMaps[sf::Keyboard::Scancode::P]->GetPressed())
+        else if((m_paused == 1 || m_paused == 3) && !m_input.IsActive(sf::Keyboard::Scancode::P))
         {
             m_paused = (m_paused + 1) % 4;
             if(m_paused == 2)
@@ -217,33 +345,46 @@ namespace GameEngine
 
     void GameThread::ExecuteLogic()
     {
+        static const auto zone = GameUtils::Profiler::Instance().RegisterZone("ExecuteLogic");
+        GameUtils::ProfileScope scope(zone);
+        m_interpolate = false;
         if(m_progression == GameUtils::Progression::PAUSE || m_progression == GameUtils::Progression::GAME_OVER) return;
-        for(auto index = 0; index < m_objects.size(); ++index)
+        for(auto& obj : m_objects)
         {
-            if(m_objects[index].GetDestroy())
+            if(obj.GetDestroy())
             {
-                m_objects.erase(m_objects.begin() + index);
+                m_objects.Destroy(obj.GetHandle());
                 continue;
             }
-            m_objects[index].StepLogic();
-            m_objects[index].DoAnimatedAction();
+            {
+                GameUtils::ProfileScope scope(LogicZone(obj.GetType()));
+                obj.StepLogic();
+            }
+            obj.DoAnimatedAction();
         }
-    }
+        m_objects.Flush();
 
-    void GameThread::ClearScreen()
-    {
-        m_window->clear(sf::Color::Black);
-        backgroundTexture = std::make_shared<sf::Texture>();
-        backgroundTexture->loadFromFile("../resources/texture/background.png");
-        backgroundSprite.setTexture(*backgroundTexture);
-        m_window->draw(backgroundSprite);
+        static const auto moveZone = GameUtils::Profiler::Instance().RegisterZone("Move");
+        {
+            GameUtils::ProfileScope moveScope(moveZone);
+            m_objects.Move();
+        }
+        static const auto collisionZone = GameUtils::Profiler::Instance().RegisterZone("Collision");
+        GameUtils::ProfileScope collisionScope(collisionZone);
+        for(const auto& contact : m_collisionSystem.Update(m_objects, &m_frameArena))
+            m_logicFunction->ContactLogic(contact);
+        m_interpolate = true;
     }
 
     void GameThread::ProgressionCheck()
-    {   
-        auto [enemySize, playerLive, bossLive] = GetLiveObjects();
+    {
+        static const auto zone = GameUtils::Profiler::Instance().RegisterZone("ProgressionCheck");
+        GameUtils::ProfileScope scope(zone);
+        const auto& world = m_objects.GetWorld();
+        auto bossLive = world.Count(GameUtils::ObjectType::BOSS);
+        auto playerLive = world.Count(GameUtils::ObjectType::PLAYER);
 
-        if(enemySize == 0)
+        if(world.Count(GameUtils::ObjectType::ENEMY) == 0)
         {
             if(m_progression == GameUtils::Progression::BOSS_PHASE && bossLive == 0)
             {
@@ -257,7 +398,7 @@ namespace GameEngine
             {
                 m_progression = GameUtils::Progression::BOSS_PHASE;
                 CreateObjectAnimated("1", GameUtils::ObjectType::BOSS, "../resources/texture/animated-boss-ship.png", "", 
-                    std::bind(&LogicFunctions::BossStartup, m_logicFunction, std::placeholders::_1, sf::Vector2i{(int)m_window->getDefaultView().getCenter().x, 0}),
+                    std::bind(&LogicFunctions::BossStartup, m_logicFunction, std::placeholders::_1, sf::Vector2i{(int)(m_viewportSize.x/2), 0}),
                     std::bind(&LogicFunctions::BossLogic, m_logicFunction, std::placeholders::_1), 164ms, 5, 5, 1, true);
             }
 
@@ -276,39 +417,52 @@ namespace GameEngine
     {
         m_progression = GameUtils::Progression::NORMAL_GAME;
 
-        m_objects.clear();
+        m_objects.Clear();
+        m_collisionSystem.Clear();
         m_textSprites.clear();
     }
 
     void GameThread::RenderText()
     {   
-        if(m_progression == GameUtils::Progression::MENU) return;
-        auto windowSize = m_window->getDefaultView().getSize();
+        if(m_progression == GameUtils::Progression::MENU || IsHeadless()) return;
         m_textSprites[GameUtils::TextType::SCORE] = {"Score: " + std::to_string(m_score), m_font, 24};
         m_textSprites[GameUtils::TextType::HIGH_SCORE] = {"Highscore: " + std::to_string(m_highscore), m_font, 24};
-        m_textSprites[GameUtils::TextType::HIGH_SCORE].setPosition({m_window->getDefaultView().getCenter().x - ((std::string("Highscore: ").size()/2)*m_textSprites[GameUtils::TextType::HIGH_SCORE].getCharacterSize()),
+        m_textSprites[GameUtils::TextType::HIGH_SCORE].setPosition({m_viewportSize.x/2 - ((std::string("Highscore: ").size()/2)*m_textSprites[GameUtils::TextType::HIGH_SCORE].getCharacterSize()),
                                                                     m_textSprites[GameUtils::TextType::HIGH_SCORE].getPosition().y});
     }
 
     void GameThread::GenerateSoundChannels()
     {    
-        for(auto soundFile : GameUtils::soundFiles)
+        m_voicePool = std::make_unique<GameUtils::VoicePool>();
+        for(std::size_t index = 0; index < GameUtils::soundFiles.size(); ++index)
         {
-            auto soundBuffer = std::make_shared<sf::SoundBuffer>();
-            soundBuffer->loadFromFile("../resources/sfx/" + soundFile);
-            m_generalSoundChannels[soundFile] = std::make_pair(soundBuffer,sf::Sound());
-            m_generalSoundChannels[soundFile].second.setBuffer(*m_generalSoundChannels[soundFile].first);
+            auto soundName = static_cast<GameUtils::SoundName>(index);
+            auto [maxVoices, priority] = GameUtils::SoundVoiceRule(soundName);
+            m_voicePool->SetBuffer(soundName, GameUtils::SoundBufferCache::Instance().Get("../resources/sfx/" + GameUtils::soundFiles[index]));
+            m_voicePool->SetRule(soundName, maxVoices, priority);
         }
     }
 
     void GameThread::PlayAudioChannel(const GameUtils::SoundName& soundName)
     {
-        m_generalSoundChannels[GameUtils::SoundNameToString(soundName)].second.play();
+        if(m_voicePool != nullptr)
+            m_voicePool->Play(soundName);
+    }
+
+    GameUtils::VoicePoolStats GameThread::GetAudioStats()
+    {
+        if(m_voicePool == nullptr) return GameUtils::VoicePoolStats{};
+        return m_voicePool->GetStats();
+    }
+
+    FramePacerStats GameThread::GetFramePacerStats() const
+    {
+        return m_renderThread.GetStats().pacer;
     }
 
     void GameThread::CreateArrayObject(const int& rows, const int& columns, const std::function<GameUtils::Object(sf::Vector2i, std::string)>& objectBuilder)
     {
-        auto windowSize = m_window->getDefaultView().getSize();
+        auto windowSize = m_viewportSize;
         auto additiveRatio = std::floor(windowSize.x / columns);
 
         for(auto row = 0; row < rows; ++row)
@@ -325,50 +479,144 @@ namespace GameEngine
 
     void GameThread::BlockingTextScreen(const std::string& text)
     {
+        if(IsHeadless()) return;
         m_textSprites[GameUtils::TextType::PAUSE] = {text, m_font, 60};
         auto textSize = m_textSprites[GameUtils::TextType::PAUSE].getCharacterSize();
         auto textLength = m_textSprites[GameUtils::TextType::PAUSE].getString().getSize();
         m_textSprites[GameUtils::TextType::PAUSE].setFillColor(sf::Color::White);
-        m_textSprites[GameUtils::TextType::PAUSE].setPosition({(m_window->getDefaultView().getSize().x/2.0f) - (textLength/2)*textSize, (m_window->getDefaultView().getSize().y/2.0f) - textSize});
+        m_textSprites[GameUtils::TextType::PAUSE].setPosition({(m_viewportSize.x/2.0f) - (textLength/2)*textSize, (m_viewportSize.y/2.0f) - textSize});
+    }
+
+    void GameThread::SimulationStep()
+    {
+        GameUtils::AllocationTracker::Instance().BeginTick();
+        static const auto zone = GameUtils::Profiler::Instance().RegisterZone("SimulationStep");
+        GameUtils::ProfileScope scope(zone);
+        auto tick = GameUtils::GetCurrentTick();
+        GameUtils::TimerWheel::Instance().Advance(tick);
+        ProgressionCheck();
+        CaptureKeyInput();
+        auto input = CurrentInput();
+        PauseLogic();
+        ExecuteLogic();
+        if(m_progression != GameUtils::Progression::PAUSE)
+            m_background.Update();
+        m_input.EndTick();
+        GameUtils::AdvanceTick();
+        if(m_recorder != nullptr)
+            m_recorder->Record(input, StateHash());
+        m_frameArena.Reset();
+        GameUtils::AllocationTracker::Instance().EndTick(tick);
+    }
+
+    SimulationState GameThread::Step(const SimulationInput& input)
+    {
+        ApplyInput(input);
+        SimulationStep();
+
+        SimulationState state;
+        const auto& world = m_objects.GetWorld();
+        state.tick = GameUtils::GetCurrentTick();
+        state.progression = m_progression;
+        state.score = m_score;
+        state.highscore = m_highscore;
+        state.enemies = static_cast<int>(world.Count(GameUtils::ObjectType::ENEMY));
+        state.players = static_cast<int>(world.Count(GameUtils::ObjectType::PLAYER));
+        state.bosses = static_cast<int>(world.Count(GameUtils::ObjectType::BOSS));
+        state.objects = m_objects.Size();
+        if(auto player = m_objects.Get(world.GetPlayer()); player != nullptr)
+            state.playerPosition = player->GetPosition();
+        state.stateHash = StateHash();
+        return state;
+    }
+
+    void GameThread::SetRecorder(const std::shared_ptr<ReplayRecorder>& recorder)
+    {
+        m_recorder = recorder;
     }
 
-    std::tuple<int,int,int> GameThread::GetLiveObjects()
+    void GameThread::ApplyInput(const SimulationInput& input)
     {
-        auto quantity = 0, playerExists = 0, bossExists = 0;
-        for(auto obj : m_objects)
+        m_input.SetDown(sf::Keyboard::Scancode::A, input.left);
+        m_input.SetDown(sf::Keyboard::Scancode::D, input.right);
+        m_input.SetDown(sf::Keyboard::Scancode::Space, input.fire);
+        m_input.SetDown(sf::Keyboard::Scancode::P, input.pause);
+        m_input.SetDown(sf::Keyboard::Scancode::Enter, input.confirm);
+    }
+
+    SimulationInput GameThread::CurrentInput()
+    {
+        //A tap pressed and released within the tick is recorded as held for that tick, replaying it yields the same IsActive sequence
+        SimulationInput input;
+        input.left = m_input.IsActive(sf::Keyboard::Scancode::A);
+        input.right = m_input.IsActive(sf::Keyboard::Scancode::D);
+        input.fire = m_input.IsActive(sf::Keyboard::Scancode::Space);
+        input.pause = m_input.IsActive(sf::Keyboard::Scancode::P);
+        input.confirm = m_input.IsActive(sf::Keyboard::Scancode::Enter);
+        return input;
+    }
+
+    uint64_t GameThread::StateHash()
+    {
+        //FNV-1a over the values logic reads back, in store order which is itself deterministic
+        uint64_t hash = 0xCBF29CE484222325ULL;
+        auto mix = [&hash](const auto& value)
         {
-            switch(obj.GetType())
-            {
-                case GameUtils::ObjectType::ENEMY:
-                    ++quantity;
-                    break;
-                case GameUtils::ObjectType::PLAYER:
-                    ++playerExists;
-                    break;
-                case GameUtils::ObjectType::BOSS:
-                    ++bossExists;
-                    break;
-            }
+            const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+            for(std::size_t byte = 0; byte < sizeof(value); ++byte)
+                hash = (hash ^ bytes[byte]) * 0x100000001B3ULL;
+        };
+
+        mix(GameUtils::GetCurrentTick());
+        mix(static_cast<int>(m_progression));
+        mix(m_score);
+        mix(m_paused);
+        for(auto& obj : m_objects)
+        {
+            auto position = obj.GetPosition();
+            mix(static_cast<int>(obj.GetType()));
+            mix(position.x);
+            mix(position.y);
+            mix(obj.GetHitPoints());
         }
-        return std::make_tuple(quantity, playerExists, bossExists);
+        return hash;
     }
 
     void GameThread::GameWatcherThread()
     {
-        while(m_window->isOpen())
+        if(IsHeadless()) return;
+        //Drawing and presenting happen on the render thread, this loop only simulates and publishes snapshots
+        GameUtils::Profiler::Instance().SetThreadName("simulation");
+        m_renderThread.Start(m_window);
+        auto previousTime = std::chrono::steady_clock::now();
+        auto accumulator = std::chrono::nanoseconds(0);
+        while(m_window->isOpen() && !m_closeRequested)
         {
-            if(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_lastFrameTime) >= GameUtils::globalFrametime)
+            auto now = std::chrono::steady_clock::now();
+            auto tickDuration = GameUtils::GetTickDuration();
+            accumulator = std::min<std::chrono::nanoseconds>(accumulator + (now - previousTime), tickDuration * GameUtils::maxTicksPerFrame);
+            previousTime = now;
+
+            auto stepped = false;
+            while(accumulator >= tickDuration && !m_closeRequested)
             {
-                m_lastFrameTime = std::chrono::steady_clock::now();
-                ClearScreen();
-                ProgressionCheck();
-                CaptureKeyInput();
-                PauseLogic();
-                ExecuteLogic();
-                DrawSprites();
-                m_window->display(); 
+                auto stepStart = std::chrono::steady_clock::now();
+                SimulationStep();
+                auto stepMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - stepStart).count();
+                m_simulationTickMs = m_simulationTickMs == 0.0 ? stepMs : m_simulationTickMs + (stepMs - m_simulationTickMs) / 16.0;
+                accumulator -= tickDuration;
+                stepped = true;
             }
+            if(stepped) PublishSnapshot();
+
+            auto renderStats = m_renderThread.GetStats();
+            m_input.MarkPresented(renderStats.lastPresent, renderStats.lastPresentedTick);
+
+            m_tickPacer.SetInterval(tickDuration);
+            m_tickPacer.WaitForNextFrame();
         }
+        m_renderThread.Stop();
+        m_window->close();
     }
 
 
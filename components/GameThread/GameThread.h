@@ -11,54 +11,100 @@
 
 #include "IGameThread.h"
 #include "LogicFunctions/LogicFunctions.h"
+#include "Background/Background.h"
+#include "Sound/VoicePool.h"
+#include "FramePacer/FramePacer.h"
+#include "SpriteBatch/SpriteBatch.h"
+#include "RenderThread/RenderThread.h"
+#include "Profiler/Profiler.h"
+#include "AllocationTracker/AllocationTracker.h"
+#include "FrameArena/FrameArena.h"
+#include "PerfOverlay/PerfOverlay.h"
+#include "Replay/Replay.h"
 
 namespace GameEngine
 {
+    // Per tick displacements above this are treated as teleports and drawn without interpolation
+    constexpr float maxInterpolatedStep = 64.0f;
+
+    // Smoothed per stage timings, simulation and rendering run on separate threads
+    struct PipelineStats
+    {
+        double simulationTickMs = 0.0;
+        double renderMs = 0.0;
+        double snapshotLatencyMs = 0.0;
+    };
+
     class GameThread : public IGameThread
     {
     public:
         ~GameThread();
 
         explicit GameThread(const std::shared_ptr<sf::RenderWindow>& window);
+        // Headless simulation: no window, no textures uploaded and no audio device opened
+        explicit GameThread(const sf::Vector2f& viewportSize);
 
         std::shared_ptr<sf::RenderWindow> GetRenderWindow() override;
-        std::vector<GameUtils::Object>& GetObjects() override;
+        sf::Vector2f GetViewportSize() override;
+        bool IsHeadless() override;
+        GameUtils::ObjectStore& GetObjects() override;
+        const GameUtils::WorldQuery& GetWorld() override;
         GameUtils::Object& CreateObject(const std::string& id = "UNKNOWN", const GameUtils::ObjectType& objType = GameUtils::ObjectType::PLAYER, 
             const std::string& texturePath = "", const std::string& soundPath = "",
             const std::function<void(GameUtils::Object&)>& startupHandler = [](GameUtils::Object&){}, const std::function<void(GameUtils::Object&)>& logicHandler = [](GameUtils::Object&){}, 
             const std::chrono::milliseconds& animationFrametime = 166ms, const int& hitPoints = 1, const int& scorePoint = 1) override;
-        std::unordered_map<sf::Keyboard::Scancode, std::shared_ptr<GameUtils::Input>>& GetKeys() override;
+        GameUtils::InputState& GetInput() override;
         GameUtils::Object& CreateObjectAnimated(const std::string& id = "UNKNOWN", const GameUtils::ObjectType& objType = GameUtils::ObjectType::PLAYER, 
             const std::string& texturePath = "", const std::string& soundPath = "",
             const std::function<void(GameUtils::Object&)>& startupHandler = [](GameUtils::Object&){}, const std::function<void(GameUtils::Object&)>& logicHandler = [](GameUtils::Object&){}, 
             const std::chrono::milliseconds& animationFrametime = 166ms, const int& hitPoints = 1, const int& scorePoint = 1, const int& textureRow = 0, const bool& isLoop = true) override;
+        ProjectilePool& GetProjectilePool() override;
         void DestroyObject(const GameUtils::Object& obj) override;
         void DestroyObjectAnimated(const GameUtils::Object& obj, const int& textureRow) override;
         int& GetScore() override;
         void SetScore(const int& score) override;
         void PlayAudioChannel(const GameUtils::SoundName& soundName) override;
+        GameUtils::VoicePoolStats GetAudioStats();
+        FramePacerStats GetFramePacerStats() const;
+        // Draw calls of the last rendered frame, sprite batches plus text
+        SpriteBatchStats GetRenderStats() const;
+        PipelineStats GetPipelineStats() const;
+        GameUtils::FrameArenaStats GetFrameArenaStats() const;
+        // Every following simulation tick appends its input and state hash to the recorder
+        void SetRecorder(const std::shared_ptr<ReplayRecorder>& recorder);
 
         void GameWatcherThread() override;
+        SimulationState Step(const SimulationInput& input) override;
     private: 
         GameThread() = default;
 
         std::shared_ptr<sf::RenderWindow> m_window;
-        std::shared_ptr<sf::Texture> backgroundTexture;
-        std::unordered_map<std::string,std::pair<std::shared_ptr<sf::SoundBuffer>, sf::Sound>> m_generalSoundChannels;
-        sf::Sprite backgroundSprite;
+        sf::Vector2f m_viewportSize;
+        std::unique_ptr<GameUtils::VoicePool> m_voicePool;
+        Background m_background;
         sf::Font m_font;
         std::map<GameUtils::TextType, sf::Text> m_textSprites;
-        std::vector<GameUtils::Object> m_objects;
-        std::unordered_map<sf::Keyboard::Scancode, std::shared_ptr<GameUtils::Input>> m_keyMaps;
+        GameUtils::ObjectStore m_objects;
+        ProjectilePool m_projectilePool{m_objects};
+        GameUtils::CollisionSystem m_collisionSystem;
+        // Transient data of the current tick, reset at the end of every SimulationStep
+        GameUtils::FrameArena m_frameArena;
+        GameUtils::InputState m_input;
         std::shared_ptr<LogicFunctions> m_logicFunction;
         int m_score = 0;
         int m_highscore = 0;
         int m_paused = 0;
+        bool m_interpolate = false;
         GameUtils::Progression m_progression;
 
         sf::Event m_keyboardEvent;
 
-        std::chrono::time_point<std::chrono::steady_clock> m_lastFrameTime;
+        FramePacer m_tickPacer;
+        RenderThread m_renderThread;
+        PerfOverlay m_overlay;
+        double m_simulationTickMs = 0.0;
+        bool m_closeRequested = false;
+        std::shared_ptr<ReplayRecorder> m_recorder;
 
         void InitializeState() override;
         void RenderStage() override;
@@ -66,16 +112,19 @@ namespace GameEngine
         void CaptureKeyInput() override;
         void PauseLogic() override;
         void ExecuteLogic() override;
-        void DrawSprites() override;
-        void ClearScreen() override;
+        void SimulationStep() override;
+        void PublishSnapshot() override;
         void ProgressionCheck() override;
         void CleanupGame() override;
         void RenderText() override;
 
+        void Startup();
         void GenerateSoundChannels();
         void CreateArrayObject(const int& rows, const int& columns, const std::function<GameUtils::Object(sf::Vector2i, std::string)>& objectBuilder);
         void BlockingTextScreen(const std::string& text);
-        std::tuple<int,int,int> GetLiveObjects(); 
+        void ApplyInput(const SimulationInput& input);
+        SimulationInput CurrentInput();
+        uint64_t StateHash();
 
     };
 
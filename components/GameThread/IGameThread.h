@@ -7,9 +7,14 @@
 #include "SFML/Audio.hpp"
 
 #include "Object/Object.h"
+#include "ObjectStore/ObjectStore.h"
+#include "Collision/CollisionSystem.h"
+#include "ProjectilePool/ProjectilePool.h"
 #include "Input/Input.h"
 #include "Sound/Sound.h"
+#include "Sound/SoundBufferCache.h"
 #include "GameUtils/GameUtils.h"
+#include "SimulationState.h"
 
 
 namespace GameEngine 
@@ -20,7 +25,10 @@ namespace GameEngine
         ~IGameThread() = default;
 
         virtual std::shared_ptr<sf::RenderWindow> GetRenderWindow() = 0;
-        virtual std::vector<GameUtils::Object>& GetObjects() = 0;
+        virtual sf::Vector2f GetViewportSize() = 0;
+        virtual bool IsHeadless() = 0;
+        virtual GameUtils::ObjectStore& GetObjects() = 0;
+        virtual const GameUtils::WorldQuery& GetWorld() = 0;
         virtual GameUtils::Object& CreateObject(const std::string& id = "UNKNOWN", const GameUtils::ObjectType& objType = GameUtils::ObjectType::PLAYER, 
             const std::string& texturePath = "", const std::string& soundPath = "",
             const std::function<void(GameUtils::Object&)>& startupHandler = [](GameUtils::Object&){}, const std::function<void(GameUtils::Object&)>& logicHandler = [](GameUtils::Object&){}, 
@@ -29,14 +37,16 @@ namespace GameEngine
             const std::string& texturePath = "", const std::string& soundPath = "",
             const std::function<void(GameUtils::Object&)>& startupHandler = [](GameUtils::Object&){}, const std::function<void(GameUtils::Object&)>& logicHandler = [](GameUtils::Object&){}, 
             const std::chrono::milliseconds& animationFrametime = 166ms, const int& hitPoints = 1, const int& scorePoint = 1, const int& textureRow = 0, const bool& isLoop = true) = 0;
+        virtual ProjectilePool& GetProjectilePool() = 0;
         virtual void DestroyObject(const GameUtils::Object& obj) = 0;
         virtual void DestroyObjectAnimated(const GameUtils::Object& obj, const int& textureRow) = 0;
-        virtual std::unordered_map<sf::Keyboard::Scancode, std::shared_ptr<GameUtils::Input>>& GetKeys() = 0;
+        virtual GameUtils::InputState& GetInput() = 0;
         virtual int& GetScore() = 0;
         virtual void SetScore(const int& score) = 0;
         virtual void PlayAudioChannel(const GameUtils::SoundName& soundName) = 0;
 
         virtual void GameWatcherThread() = 0;
+        virtual SimulationState Step(const SimulationInput& input) = 0;
     private:
         virtual void InitializeState() = 0;
         virtual void RenderStage() = 0;
@@ -44,8 +54,8 @@ namespace GameEngine
         virtual void CaptureKeyInput() = 0;
         virtual void PauseLogic() = 0;
         virtual void ExecuteLogic() = 0;
-        virtual void DrawSprites() = 0;
-        virtual void ClearScreen() = 0;
+        virtual void SimulationStep() = 0;
+        virtual void PublishSnapshot() = 0;
         virtual void ProgressionCheck() = 0;
         virtual void CleanupGame() = 0;
         virtual void RenderText() = 0;
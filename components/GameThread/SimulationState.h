@@ -0,0 +1,33 @@
+#pragma once
+
+#include "SFML/System.hpp"
+
+#include "GameUtils/GameUtils.h"
+
+namespace GameEngine
+{
+    // Keys held during one simulation tick
+    struct SimulationInput
+    {
+        bool left = false;
+        bool right = false;
+        bool fire = false;
+        bool pause = false;
+        bool confirm = false;
+    };
+
+    struct SimulationState
+    {
+        GameUtils::Tick tick = 0;
+        GameUtils::Progression progression = GameUtils::Progression::MENU;
+        int score = 0;
+        int highscore = 0;
+        int enemies = 0;
+        int players = 0;
+        int bosses = 0;
+        std::size_t objects = 0;
+        sf::Vector2f playerPosition;
+        // Digest of progression, score and every live object, equal states hash equal across runs
+        uint64_t stateHash = 0;
+    };
+}
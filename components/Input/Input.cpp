@@ -1,14 +1,99 @@
+#include <algorithm>
+
 #include "Input.h"
 
 namespace GameUtils
 {
-    void Input::SetPressed(bool isPressed)
+    bool InputState::IsValid(const sf::Keyboard::Scancode& key)
+    {
+        return key >= 0 && static_cast<std::size_t>(key) < keyCount;
+    }
+
+    bool InputState::IsDown(const sf::Keyboard::Scancode& key) const
+    {
+        return IsValid(key) && m_down.test(key);
+    }
+
+    bool InputState::WasPressed(const sf::Keyboard::Scancode& key) const
+    {
+        return IsValid(key) && m_pressed.test(key);
+    }
+
+    bool InputState::WasReleased(const sf::Keyboard::Scancode& key) const
+    {
+        return IsValid(key) && m_released.test(key);
+    }
+
+    bool InputState::IsActive(const sf::Keyboard::Scancode& key) const
+    {
+        return IsDown(key) || WasPressed(key);
+    }
+
+    void InputState::EndTick()
+    {
+        m_pressed.reset();
+        m_released.reset();
+    }
+
+    void InputState::SetDown(const sf::Keyboard::Scancode& key, const bool& down)
+    {
+        if(!IsValid(key) || m_down.test(key) == down) return;
+        m_down.set(key, down);
+        if(down)
+            m_pressed.set(key);
+        else
+            m_released.set(key);
+    }
+
+    void InputState::Push(const InputEvent& event)
+    {
+        SetDown(event.key, event.pressed);
+        m_events[m_eventsWritten % eventCapacity] = event;
+        ++m_eventsWritten;
+    }
+
+    void InputState::Clear()
+    {
+        m_down.reset();
+        EndTick();
+        m_eventsWritten = m_eventsPresented = 0;
+    }
+
+    std::size_t InputState::GetEventCount() const
+    {
+        return std::min(m_eventsWritten, eventCapacity);
+    }
+
+    const InputEvent& InputState::GetEvent(const std::size_t& index) const
+    {
+        return m_events[(m_eventsWritten - GetEventCount() + index) % eventCapacity];
+    }
+
+    void InputState::MarkPresented(const std::chrono::steady_clock::time_point& presentedAt, const Tick& currentTick)
+    {
+        //Events overwritten before a present are lost for the measurement
+        m_eventsPresented = std::max(m_eventsPresented, m_eventsWritten - GetEventCount());
+        while(m_eventsPresented < m_eventsWritten)
+        {
+            const auto& event = m_events[m_eventsPresented % eventCapacity];
+            if(event.tick >= currentTick) break;
+
+            auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(presentedAt - event.timestamp);
+            m_latencyStats.last = latency;
+            m_latencyStats.worst = std::max(m_latencyStats.worst, latency);
+            ++m_latencyStats.samples;
+            if(m_latencyHook) m_latencyHook(event, latency);
+            ++m_eventsPresented;
+        }
+    }
+
+    void InputState::SetLatencyHook(const LatencyHook& hook)
     {
-        m_isPressed = isPressed;
+        m_latencyHook = hook;
     }
 
-    bool Input::GetPressed()
+    InputLatencyStats InputState::GetLatencyStats() const
     {
-        return m_isPressed;
+        return m_latencyStats;
     }
-}
\ No newline at end of file
+}
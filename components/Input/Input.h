@@ -1,35 +1,79 @@
 #pragma once
 
 #include <array>
-#include <mutex>
+#include <bitset>
+#include <chrono>
+#include <cstddef>
+#include <functional>
 #include "SFML/Window.hpp"
 
+#include "GameUtils/GameUtils.h"
+
 namespace GameUtils
-{   
-    constexpr std::array<sf::Keyboard::Scancode,5> Keyboard_Keys = {
-        sf::Keyboard::Scancode::A, 
-        sf::Keyboard::Scancode::D, 
-        sf::Keyboard::Scancode::Space,
-        sf::Keyboard::Scancode::P,
-        sf::Keyboard::Scancode::Enter
+{
+    // Key transition as drained from the window, stamped with the wall clock and the tick that consumed it
+    struct InputEvent
+    {
+        sf::Keyboard::Scancode key = sf::Keyboard::Scancode::Unknown;
+        bool pressed = false;
+        std::chrono::steady_clock::time_point timestamp;
+        Tick tick = 0;
+    };
+
+    struct InputLatencyStats
+    {
+        std::chrono::nanoseconds last{0};
+        std::chrono::nanoseconds worst{0};
+        std::size_t samples = 0;
     };
 
-    class Input
+    // Flat key state: one bit per scancode for held keys, plus the keys that went down or up during the current tick.
+    // Every transition is also kept in a fixed ring of the most recent events.
+    class InputState
     {
     public:
-        Input(const sf::Keyboard::Scancode& inputIdentifier) : m_inputIdentifier(inputIdentifier)
-        {}
+        static constexpr std::size_t eventCapacity = 64;
+        using LatencyHook = std::function<void(const InputEvent&, const std::chrono::nanoseconds&)>;
+
+        bool IsDown(const sf::Keyboard::Scancode& key) const;
+        bool WasPressed(const sf::Keyboard::Scancode& key) const;
+        bool WasReleased(const sf::Keyboard::Scancode& key) const;
+        // Held now or pressed at any point of the tick, a press and release drained in the same tick still counts.
+        // Gameplay reads keys through this so quick taps are never lost between two ticks.
+        bool IsActive(const sf::Keyboard::Scancode& key) const;
 
-        friend std::ostream& operator<<(std::ostream& o, Input& input)
-        {
-            o << "Key " + sf::Keyboard::getDescription(input.m_inputIdentifier).toAnsiString() + " is " << ((input.m_isPressed) ? "pressed" : "not pressed") << std::endl; 
-            return o;
-        } 
+        // Clears the edge bits once the tick that saw them has run
+        void EndTick();
+        // Sets a key level, edges are only raised when the level actually changes
+        void SetDown(const sf::Keyboard::Scancode& key, const bool& down);
+        // Applies a transition and records it in the ring
+        void Push(const InputEvent& event);
+        void Clear();
+
+        // Events from oldest to newest, older ones are overwritten once the ring is full
+        std::size_t GetEventCount() const;
+        const InputEvent& GetEvent(const std::size_t& index) const;
+
+        // Input to photon: called right after a frame was presented, every event already consumed
+        // by a simulated tick is reported once with the time between its arrival and presentedAt
+        void MarkPresented(const std::chrono::steady_clock::time_point& presentedAt, const Tick& currentTick);
+        void SetLatencyHook(const LatencyHook& hook);
+        InputLatencyStats GetLatencyStats() const;
 
-        void SetPressed(bool isPressed);
-        bool GetPressed();
     private:
-        sf::Keyboard::Scancode m_inputIdentifier;
-        bool m_isPressed = false;
+        static constexpr std::size_t keyCount = static_cast<std::size_t>(sf::Keyboard::Scancode::ScancodeCount);
+
+        std::bitset<keyCount> m_down;
+        std::bitset<keyCount> m_pressed;
+        std::bitset<keyCount> m_released;
+
+        std::array<InputEvent, eventCapacity> m_events;
+        std::size_t m_eventsWritten = 0;
+        std::size_t m_eventsPresented = 0;
+
+        LatencyHook m_latencyHook;
+        InputLatencyStats m_latencyStats;
+
+        static bool IsValid(const sf::Keyboard::Scancode& key);
     };
-}
\ No newline at end of file
+}
@@ -1,6 +1,5 @@
 #include <cmath>
 #include <iostream>
-#include <random>
 #include <functional>
 
 #include "LogicFunctions.h"
@@ -10,54 +9,116 @@
 
 namespace GameEngine
 {
+    LogicFunctions::LogicFunctions(const std::shared_ptr<IGameThread>& gameThread) 
+        : m_gameThread(std::move(gameThread))
+    {
+        for(auto cycle = 0; cycle < GameUtils::enemyQuantity[1]; ++cycle)
+            m_enemyPalettes.push_back(GameUtils::Palette::Cycled("enemy", {GameUtils::red, GameUtils::darkerRed}, cycle));
+        m_bossProjectilePalette = GameUtils::Palette::Cycled("boss-projectile", {0xAC3232FF, 0xDF7126FF, 0xFBF236FF}, 0);
+    }
+
+    void LogicFunctions::PrewarmVariants()
+    {
+        for(auto& palette : m_enemyPalettes)
+            GameUtils::Object::PaletteTexture("../resources/texture/animated-enemy-ship.png", palette);
+        GameUtils::Object::PaletteTexture("../resources/texture/animated-enemy-projectile.png", m_bossProjectilePalette);
+    }
+
+    void LogicFunctions::RegisterProjectiles(ProjectilePool& pool)
+    {
+        //Pools hold whole bursts and drop past them, firing never constructs an object mid game
+        ProjectileKindDesc playerShot;
+        playerShot.type = GameUtils::ObjectType::PROJECTILE;
+        playerShot.id = "1";
+        playerShot.texturePath = "../resources/texture/animated-projectile.png";
+        playerShot.soundPath = "../resources/sfx/player-shot.wav";
+        playerShot.logic = [this](GameUtils::Object& obj) { ProjectileLogic(obj); };
+        playerShot.capacity = 1024;
+        pool.Register(ProjectileKind::PLAYER_SHOT, playerShot);
+
+        ProjectileKindDesc enemyShot;
+        enemyShot.type = GameUtils::ObjectType::ENEMY_PROJECTILE;
+        enemyShot.id = "1";
+        enemyShot.texturePath = "../resources/texture/animated-enemy-projectile.png";
+        enemyShot.soundPath = "../resources/sfx/enemy-shot.wav";
+        enemyShot.logic = [this](GameUtils::Object& obj) { EnemyProjectileLogic(obj); };
+        enemyShot.capacity = 1024;
+        pool.Register(ProjectileKind::ENEMY_SHOT, enemyShot);
+
+        //The spread shot reuses the enemy projectile recolored, the palette is bound once per pooled object
+        ProjectileKindDesc bossSpreadShot;
+        bossSpreadShot.type = GameUtils::ObjectType::BOSS_PROJECTILE;
+        bossSpreadShot.id = "2";
+        bossSpreadShot.texturePath = "../resources/texture/animated-enemy-projectile.png";
+        bossSpreadShot.prepare = [this](GameUtils::Object& obj) { obj.SetPalette(m_bossProjectilePalette); };
+        bossSpreadShot.logic = [this](GameUtils::Object& obj) { EnemyProjectileLogic(obj); };
+        bossSpreadShot.animationFrametime = 200ms;
+        bossSpreadShot.capacity = 4096;
+        pool.Register(ProjectileKind::BOSS_SPREAD_SHOT, bossSpreadShot);
+
+        ProjectileKindDesc bossShot;
+        bossShot.type = GameUtils::ObjectType::BOSS_PROJECTILE;
+        bossShot.id = "1";
+        bossShot.texturePath = "../resources/texture/animated-boss-projectile.png";
+        bossShot.soundPath = "../resources/sfx/enemy-shot.wav";
+        bossShot.logic = [this](GameUtils::Object& obj) { BossProjectileLogic(obj); };
+        bossShot.animationFrametime = 200ms;
+        bossShot.capacity = 1024;
+        pool.Register(ProjectileKind::BOSS_SHOT, bossShot);
+    }
 
     void LogicFunctions::PlayerStartup(GameUtils::Object& obj, const sf::Vector2i& initialPos)
     {
         auto posX = std::abs(initialPos.x - obj.GetSprite().getTextureRect().getSize().x/2);
         auto posY = std::abs(initialPos.y - obj.GetSprite().getTextureRect().getSize().y/2);
  
-        obj.GetSprite().setPosition(posX, posY);
+        obj.SetPosition(posX, posY);
+        obj.StartCooldown(GameUtils::AuxTimer::PRIMARY, static_cast<int>(posY/(2*projectileVelocityY)));
     }
 
     void LogicFunctions::PlayerLogic(GameUtils::Object& obj)
     {
         //Horizontal Movement
-        auto left = (m_gameThread->GetKeys()[sf::Keyboard::Scancode::A]->GetPressed()) ? -1 : 0;
-        auto right = (m_gameThread->GetKeys()[sf::Keyboard::Scancode::D]->GetPressed()) ? 1 : 0;
-        auto projectile = m_gameThread->GetKeys()[sf::Keyboard::Scancode::Space]->GetPressed();
+        auto left = m_gameThread->GetInput().IsActive(sf::Keyboard::Scancode::A) ? -1 : 0;
+        auto right = m_gameThread->GetInput().IsActive(sf::Keyboard::Scancode::D) ? 1 : 0;
+        auto projectile = m_gameThread->GetInput().IsActive(sf::Keyboard::Scancode::Space);
 
-        auto nextPosition = obj.GetSprite().getPosition().x + ((left + right) * playerShipVelocityX);
-        if(nextPosition > (m_gameThread->GetRenderWindow()->getSize().x - obj.GetSprite().getLocalBounds().getSize().x)) nextPosition -= playerShipVelocityX;
+        auto position = obj.GetPosition();
+        auto nextPosition = position.x + ((left + right) * playerShipVelocityX);
+        if(nextPosition > (m_gameThread->GetViewportSize().x - obj.GetSprite().getLocalBounds().getSize().x)) nextPosition -= playerShipVelocityX;
         if(nextPosition < 0) nextPosition += playerShipVelocityX;
-        obj.GetSprite().setPosition(nextPosition, obj.GetSprite().getPosition().y);
+        obj.SetVelocity(nextPosition - position.x, 0.0f);
 
-        auto ticks = static_cast<int>(obj.GetSprite().getPosition().y/(2*projectileVelocityY));
+        auto ticks = static_cast<int>(position.y/(2*projectileVelocityY));
         //Projectile instantiation
-        if(projectile && GameUtils::IsExpired(obj.GetAuxiliarTimeStamp()["Primary"], ticks))
+        if(projectile && obj.CooldownReady(GameUtils::AuxTimer::PRIMARY))
         {
-            obj.GetAuxiliarTimeStamp()["Primary"] = std::chrono::steady_clock::now();
+            obj.StartCooldown(GameUtils::AuxTimer::PRIMARY, ticks);
             obj.SetupAnimatedAction(0, false);
-            m_gameThread->CreateObject("1", GameUtils::ObjectType::PROJECTILE, "../resources/texture/animated-projectile.png", "../resources/sfx/player-shot.wav",
-                std::bind(LogicFunctions::ProjectileSetup, this, std::placeholders::_1),
-                std::bind(LogicFunctions::ProjectileLogic, this, std::placeholders::_1), 150ms, 1);
+            m_gameThread->GetProjectilePool().Spawn(ProjectileKind::PLAYER_SHOT, [this](GameUtils::Object& projectile) { ProjectileSetup(projectile); });
         }
     }
     void LogicFunctions::EnemyStartup(GameUtils::Object& obj, const sf::Vector2i& initialPos)
     {
         auto colorSeparator = stoi(obj.GetId()) / GameUtils::enemyQuantity[0];
-        std::vector<uint32_t> colors({GameUtils::red, GameUtils::darkerRed});
-        PixelColorSwap(*obj.GetTexture(), colors, -1, colorSeparator);
+        obj.SetPalette(m_enemyPalettes[colorSeparator % m_enemyPalettes.size()]);
 
-        obj.GetAuxiliarVars()["movementCounter"] = 0; // Orientation X-Axis counter
-        obj.GetAuxiliarVars()["baseVelocityX"] = 3; // Base velocity of the enemy ship on X-Axis
+        obj.GetAuxiliarVars()[GameUtils::AuxVar::MOVEMENT_COUNTER] = 0; // Orientation X-Axis counter
+        obj.GetAuxiliarVars()[GameUtils::AuxVar::BASE_VELOCITY_X] = 3; // Base velocity of the enemy ship on X-Axis
 
-        m_enemyQnt = GameUtils::enemyQuantity[0]*GameUtils::enemyQuantity[1];
-        for(auto index = 0; index < m_enemyQnt; ++index)
-            m_randomPos.push_back(index);
+        //The first ship of the array starts a new volley order for the run
+        if(stoi(obj.GetId()) == 0)
+        {
+            m_volleyShooters.Reset(GameUtils::enemyQuantity[0]*GameUtils::enemyQuantity[1]);
+            m_nextShooter = -1;
+            m_shooterTick = 0;
+            //Holds fire for the first volley delay of the level
+            m_volleyTick = GameUtils::GetCurrentTick();
+        }
         auto posX = std::abs(initialPos.x - obj.GetSprite().getTextureRect().getSize().x/2);
         auto posY = std::abs(initialPos.y - obj.GetSprite().getTextureRect().getSize().y/2);
  
-        obj.GetSprite().setPosition(posX, posY);
+        obj.SetPosition(posX, posY);
         obj.SetTimer(obj.GetAnimationFrametime(), true);
     }
 
@@ -65,120 +126,108 @@ namespace GameEngine
     {
         auto enemyInstance = std::make_pair(GameUtils::ObjectType::ENEMY, stoi(obj.GetId()));
 
-        if(obj.GetAuxiliarVars()["movementCounter"]++ == 30)
+        if(obj.GetAuxiliarVars()[GameUtils::AuxVar::MOVEMENT_COUNTER]++ == 30)
         {
-            obj.GetAuxiliarVars()["baseVelocityX"] = -obj.GetAuxiliarVars()["baseVelocityX"];
-            obj.GetAuxiliarVars()["movementCounter"] = 0;
+            obj.GetAuxiliarVars()[GameUtils::AuxVar::BASE_VELOCITY_X] = -obj.GetAuxiliarVars()[GameUtils::AuxVar::BASE_VELOCITY_X];
+            obj.GetAuxiliarVars()[GameUtils::AuxVar::MOVEMENT_COUNTER] = 0;
         }
-        int nextPosition = obj.GetSprite().getPosition().x - obj.GetAuxiliarVars()["baseVelocityX"];
-        if(nextPosition > m_gameThread->GetRenderWindow()->getSize().x) nextPosition -= obj.GetAuxiliarVars()["baseVelocityX"];
-        if(nextPosition <= 0) nextPosition += obj.GetAuxiliarVars()["baseVelocityX"];
-        obj.GetSprite().setPosition(nextPosition, obj.GetSprite().getPosition().y);
-
-        auto position = obj.GetSprite().getPosition();
+        int nextPosition = obj.GetPosition().x - obj.GetAuxiliarVars()[GameUtils::AuxVar::BASE_VELOCITY_X];
+        if(nextPosition > m_gameThread->GetViewportSize().x) nextPosition -= obj.GetAuxiliarVars()[GameUtils::AuxVar::BASE_VELOCITY_X];
+        if(nextPosition <= 0) nextPosition += obj.GetAuxiliarVars()[GameUtils::AuxVar::BASE_VELOCITY_X];
+        obj.SetVelocity(nextPosition - obj.GetPosition().x, 0.0f);
 
-        RandomShuffler(m_randomPos, m_enemyQnt);
+        //Where the movement pass puts the ship this tick
+        auto position = obj.GetPosition() + obj.GetVelocity();
 
-        auto playerPosition = std::find_if(m_gameThread->GetObjects().begin(), m_gameThread->GetObjects().end(), [](const GameUtils::Object& obj){
-            return obj.GetType() == GameUtils::ObjectType::PLAYER;
-        })->GetSprite().getPosition();
+        auto playerPosition = PlayerPosition();
         auto ticks = static_cast<int>((playerPosition.y - position.y)/(2*projectileVelocityY));
 
-        if(stoi(obj.GetId()) == m_randomPos.back() && GameUtils::IsExpired(m_auxiliarTimestamp, ticks))
-        {
-            m_randomPos.pop_back();
-            m_auxiliarTimestamp = std::chrono::steady_clock::now();
-            m_gameThread->CreateObject("1", GameUtils::ObjectType::ENEMY_PROJECTILE, "../resources/texture/animated-enemy-projectile.png", "../resources/sfx/enemy-shot.wav",
-                std::bind(LogicFunctions::EnemyProjectileSetup, this, std::placeholders::_1, sf::Vector2i{position.x,position.y}, enemyInstance),
-                std::bind(LogicFunctions::EnemyProjectileLogic, this, std::placeholders::_1), 150ms, 1);
-        }
-
+        //The delay is checked against the shooter's flight time on every tick, not fixed when the last volley was fired
+        if(stoi(obj.GetId()) != NextVolleyShooter()) return;
+        auto tick = GameUtils::GetCurrentTick();
+        m_shooterSeenTick = tick;
+        if(tick - m_volleyTick < static_cast<GameUtils::Tick>(std::max(ticks, 0))) return;
 
+        m_volleyTick = tick;
+        m_nextShooter = -1;
+        m_gameThread->GetProjectilePool().Spawn(ProjectileKind::ENEMY_SHOT, [&](GameUtils::Object& projectile) {
+            EnemyProjectileSetup(projectile, sf::Vector2i{position}, enemyInstance);
+        });
     }
 
     void LogicFunctions::ProjectileSetup(GameUtils::Object& obj)
     {
-        auto playerPosition = std::find_if(m_gameThread->GetObjects().begin(), m_gameThread->GetObjects().end(), [](const GameUtils::Object& obj){
-            return obj.GetType() == GameUtils::ObjectType::PLAYER;
-        });
+        auto playerPosition = PlayerPosition();
 
-        obj.GetAuxiliarVars()["pinMovement"] = 0;
+        obj.GetAuxiliarVars()[GameUtils::AuxVar::PIN_MOVEMENT] = 0;
+        obj.GetAuxiliarVars()[GameUtils::AuxVar::HIT_TEXTURE_ROW] = 0;
         m_gameThread->PlayAudioChannel(GameUtils::SoundName::PLAYER_SHOT); 
-        obj.GetSprite().setPosition(playerPosition->GetSprite().getPosition().x, playerPosition->GetSprite().getPosition().y - obj.GetSprite().getGlobalBounds().getSize().y);
+        obj.SetPosition(playerPosition.x, playerPosition.y - obj.GetSprite().getGlobalBounds().getSize().y);
     }
 
     void LogicFunctions::ProjectileLogic(GameUtils::Object& obj)
     {
-        auto currentPosition = obj.GetSprite().getPosition();
+        auto currentPosition = obj.GetPosition();
 
         if(currentPosition.y >= 0)
         {
-            if(obj.GetAuxiliarVars()["pinMovement"] == 0)
-                obj.GetSprite().setPosition(currentPosition.x, currentPosition.y - projectileVelocityY);
+            if(obj.GetAuxiliarVars()[GameUtils::AuxVar::PIN_MOVEMENT] == 0)
+                obj.SetVelocity(0.0f, -projectileVelocityY);
+            else
+                obj.SetVelocity(0.0f, 0.0f);
         }
         else 
         {
             DestroyObject(obj);
             return;
         }
-
-        ObjectCollison(obj, {GameUtils::ObjectType::ENEMY, GameUtils::ObjectType::BOSS}, GameUtils::SoundName::ENEMY_DEATH);
     }
 
     void LogicFunctions::EnemyProjectileSetup(GameUtils::Object& obj, const sf::Vector2i& initialPos, const std::pair<GameUtils::ObjectType, int>& assistId)
     {
-        if(obj.GetType() == GameUtils::ObjectType::BOSS_PROJECTILE)
-        {
-            std::vector<uint32_t> colors({0xAC3232FF,0xDF7126FF,0xFBF236FF});
-            PixelColorSwap(*obj.GetTexture(), colors, -1, 0);
-        }
-
-        auto playerPosition = std::find_if(m_gameThread->GetObjects().begin(), m_gameThread->GetObjects().end(), [](const GameUtils::Object& obj){
-            return obj.GetType() == GameUtils::ObjectType::PLAYER;
-        })->GetSprite().getPosition();
+        auto playerPosition = PlayerPosition();
         auto ticks = static_cast<int>((playerPosition.y - initialPos.y)/projectileVelocityY);
         auto projectileVelX = static_cast<int>(std::ceil((playerPosition.x - initialPos.x)/ticks));
 
-        obj.GetAuxiliarVars()["Direction"] = 0;
-        obj.GetAuxiliarVars()["pinMovement"] = 0;
-        obj.GetAuxiliarVars()["mutableProjectileVelocity"] = projectileVelocityY;
-        obj.GetAuxiliarVars()["maximumSpacement"] = playerPosition.y - initialPos.y;
+        obj.GetAuxiliarVars()[GameUtils::AuxVar::DIRECTION] = 0;
+        obj.GetAuxiliarVars()[GameUtils::AuxVar::PIN_MOVEMENT] = 0;
+        obj.GetAuxiliarVars()[GameUtils::AuxVar::MUTABLE_PROJECTILE_VELOCITY] = projectileVelocityY;
+        obj.GetAuxiliarVars()[GameUtils::AuxVar::MAXIMUM_SPACEMENT] = playerPosition.y - initialPos.y;
+        obj.GetAuxiliarVars()[GameUtils::AuxVar::HIT_TEXTURE_ROW] = 1;
 
         m_gameThread->PlayAudioChannel(GameUtils::SoundName::ENEMY_SHOT); 
         if(static_cast<int>(playerPosition.x - initialPos.x) != 0)
-            obj.GetAuxiliarVars()["Direction"] = projectileVelX;
+            obj.GetAuxiliarVars()[GameUtils::AuxVar::DIRECTION] = projectileVelX;
 
 
-        obj.GetSprite().setPosition(initialPos.x, initialPos.y + obj.GetSprite().getGlobalBounds().getSize().y);
+        obj.SetPosition(initialPos.x, initialPos.y + obj.GetSprite().getGlobalBounds().getSize().y);
     }
 
     void LogicFunctions::EnemyProjectileLogic(GameUtils::Object& obj)
     {
-        auto currentPosition = obj.GetSprite().getPosition();
+        auto currentPosition = obj.GetPosition();
 
         if(obj.GetType() == GameUtils::ObjectType::BOSS_PROJECTILE)
         {
-            obj.GetAuxiliarVars()["mutableProjectileVelocity"] = minorProjectileVelocityBossY;
-            auto playerPosition = std::find_if(m_gameThread->GetObjects().begin(), m_gameThread->GetObjects().end(), [](const GameUtils::Object& obj){
-                    return obj.GetType() == GameUtils::ObjectType::PLAYER;
-                })->GetSprite().getPosition();
-            if(std::abs(static_cast<int>(playerPosition.y - currentPosition.y)) <= (obj.GetAuxiliarVars()["maximumSpacement"]/7))
+            obj.GetAuxiliarVars()[GameUtils::AuxVar::MUTABLE_PROJECTILE_VELOCITY] = minorProjectileVelocityBossY;
+            auto playerPosition = PlayerPosition();
+            if(std::abs(static_cast<int>(playerPosition.y - currentPosition.y)) <= (obj.GetAuxiliarVars()[GameUtils::AuxVar::MAXIMUM_SPACEMENT]/7))
             {
-                obj.GetAuxiliarVars()["mutableProjectileVelocity"] = 3;
+                obj.GetAuxiliarVars()[GameUtils::AuxVar::MUTABLE_PROJECTILE_VELOCITY] = 3;
             }
         }
-        if(currentPosition.y < m_gameThread->GetRenderWindow()->getDefaultView().getSize().y)
+        if(currentPosition.y < m_gameThread->GetViewportSize().y)
         {
-            if(obj.GetAuxiliarVars()["pinMovement"] == 0)
-                obj.GetSprite().setPosition(currentPosition.x + obj.GetAuxiliarVars()["Direction"], currentPosition.y + obj.GetAuxiliarVars()["mutableProjectileVelocity"]);
+            if(obj.GetAuxiliarVars()[GameUtils::AuxVar::PIN_MOVEMENT] == 0)
+                obj.SetVelocity(obj.GetAuxiliarVars()[GameUtils::AuxVar::DIRECTION], obj.GetAuxiliarVars()[GameUtils::AuxVar::MUTABLE_PROJECTILE_VELOCITY]);
+            else
+                obj.SetVelocity(0.0f, 0.0f);
         }
         else 
         {
             DestroyObject(obj);
             return;
         }
-
-        ObjectCollison(obj, {GameUtils::ObjectType::PLAYER}, GameUtils::SoundName::ENEMY_DEATH, 1);
     }
     
     void LogicFunctions::BossStartup(GameUtils::Object& obj, const sf::Vector2i& initialPos)
@@ -186,232 +235,162 @@ namespace GameEngine
         auto posX = std::abs(initialPos.x - obj.GetSprite().getTextureRect().getSize().x/2);
         auto posY = std::abs(initialPos.y - obj.GetSprite().getTextureRect().getSize().y/2);
  
-        obj.GetAuxiliarTimeStamp()["Second"] = std::chrono::steady_clock::now();
-        obj.GetAuxiliarVars()["Direction"] = 6;
-        obj.GetAuxiliarVars()["BulletPosition"] = 0;
-        obj.GetAuxiliarVars()["0"] = 0;
-        obj.GetAuxiliarVars()["1"] = -obj.GetSprite().getLocalBounds().getSize().x/2;
-        obj.GetAuxiliarVars()["2"] = obj.GetSprite().getLocalBounds().getSize().x/2;
-
-        obj.GetSprite().setPosition(posX, posY);
+        obj.GetAuxiliarVars()[GameUtils::AuxVar::DIRECTION] = 6;
+        obj.GetAuxiliarVars()[GameUtils::AuxVar::BULLET_POSITION] = 0;
+        obj.GetAuxiliarVars()[GameUtils::AuxVar::BULLET_OFFSET_0] = 0;
+        obj.GetAuxiliarVars()[GameUtils::AuxVar::BULLET_OFFSET_1] = -obj.GetSprite().getLocalBounds().getSize().x/2;
+        obj.GetAuxiliarVars()[GameUtils::AuxVar::BULLET_OFFSET_2] = obj.GetSprite().getLocalBounds().getSize().x/2;
+
+        obj.SetPosition(posX, posY);
         obj.SetTimer(obj.GetAnimationFrametime(), true);
+
+        //The boss holds fire for one volley period after spawning
+        auto playerPosition = PlayerPosition();
+        auto ticks = static_cast<int>((playerPosition.y - posY)/(2*projectileVelocityY));
+        obj.StartCooldown(GameUtils::AuxTimer::PRIMARY, ticks);
+        obj.StartCooldown(GameUtils::AuxTimer::SECOND, ticks / 2);
     }
 
     void LogicFunctions::BossLogic(GameUtils::Object& obj)
     {   
-        const int movementRange = (m_gameThread->GetRenderWindow()->getDefaultView().getSize().x/4);
+        const int movementRange = (m_gameThread->GetViewportSize().x/4);
 
-        if(obj.GetSprite().getPosition().x <= (movementRange - (obj.GetSprite().getTextureRect().getSize().x/2)) || obj.GetSprite().getPosition().x >= (3*movementRange))
+        if(obj.GetPosition().x <= (movementRange - (obj.GetSprite().getTextureRect().getSize().x/2)) || obj.GetPosition().x >= (3*movementRange))
         {
-            obj.GetAuxiliarVars()["Direction"] = -obj.GetAuxiliarVars()["Direction"];
+            obj.GetAuxiliarVars()[GameUtils::AuxVar::DIRECTION] = -obj.GetAuxiliarVars()[GameUtils::AuxVar::DIRECTION];
         }
-        int nextPosition = obj.GetSprite().getPosition().x - obj.GetAuxiliarVars()["Direction"];
-        if(nextPosition > m_gameThread->GetRenderWindow()->getSize().x) nextPosition = 0;
-        if(nextPosition <= 0) nextPosition = m_gameThread->GetRenderWindow()->getSize().x;
-        obj.GetSprite().setPosition(nextPosition, obj.GetSprite().getPosition().y);
+        int nextPosition = obj.GetPosition().x - obj.GetAuxiliarVars()[GameUtils::AuxVar::DIRECTION];
+        if(nextPosition > m_gameThread->GetViewportSize().x) nextPosition = 0;
+        if(nextPosition <= 0) nextPosition = m_gameThread->GetViewportSize().x;
+        obj.SetVelocity(nextPosition - obj.GetPosition().x, 0.0f);
 
-        auto position = obj.GetSprite().getPosition();
+        //Where the movement pass puts the boss this tick
+        auto position = obj.GetPosition() + obj.GetVelocity();
 
-        auto playerPosition = std::find_if(m_gameThread->GetObjects().begin(), m_gameThread->GetObjects().end(), [](const GameUtils::Object& obj){
-            return obj.GetType() == GameUtils::ObjectType::PLAYER;
-        })->GetSprite().getPosition();
+        auto playerPosition = PlayerPosition();
         auto ticks = static_cast<int>((playerPosition.y - position.y)/(2*projectileVelocityY));
         auto minorTicks = ticks / 2;
-        if(GameUtils::IsExpired(obj.GetAuxiliarTimeStamp()["Second"], minorTicks))
+        if(obj.CooldownReady(GameUtils::AuxTimer::SECOND))
         {
             obj.SetupAnimatedAction(2, false, false, true, 1);
-            obj.GetAuxiliarTimeStamp()["Second"] = std::chrono::steady_clock::now();
-            m_gameThread->CreateObject("2", GameUtils::ObjectType::BOSS_PROJECTILE, "../resources/texture/animated-enemy-projectile.png", "",
-                std::bind(LogicFunctions::EnemyProjectileSetup, this, std::placeholders::_1, sf::Vector2i{position.x + (obj.GetSprite().getLocalBounds().getSize().x/2) + obj.GetAuxiliarVars()[std::to_string(obj.GetAuxiliarVars()["BulletPosition"])], position.y + (obj.GetSprite().getLocalBounds().getSize().y/2)}, std::make_pair<GameUtils::ObjectType,int>(GameUtils::ObjectType::UNKNOWN,0)),
-                std::bind(LogicFunctions::EnemyProjectileLogic, this, std::placeholders::_1), 200ms, 1);
-            obj.GetAuxiliarVars()["BulletPosition"] = (obj.GetAuxiliarVars()["BulletPosition"] + 1) % 3;
+            obj.StartCooldown(GameUtils::AuxTimer::SECOND, minorTicks);
+            auto spawnPosition = sf::Vector2i{position.x + (obj.GetSprite().getLocalBounds().getSize().x/2) + obj.GetAuxiliarVars()[GameUtils::BulletOffset(obj.GetAuxiliarVars()[GameUtils::AuxVar::BULLET_POSITION])], position.y + (obj.GetSprite().getLocalBounds().getSize().y/2)};
+            m_gameThread->GetProjectilePool().Spawn(ProjectileKind::BOSS_SPREAD_SHOT, [&](GameUtils::Object& projectile) {
+                EnemyProjectileSetup(projectile, spawnPosition, std::make_pair(GameUtils::ObjectType::UNKNOWN, 0));
+            });
+            obj.GetAuxiliarVars()[GameUtils::AuxVar::BULLET_POSITION] = (obj.GetAuxiliarVars()[GameUtils::AuxVar::BULLET_POSITION] + 1) % 3;
         }
-        if(GameUtils::IsExpired(obj.GetAuxiliarTimeStamp()["Primary"], ticks))
+        if(obj.CooldownReady(GameUtils::AuxTimer::PRIMARY))
         {
             obj.SetupAnimatedAction(2, false, false, true, 1);
-            obj.GetAuxiliarTimeStamp()["Primary"] = std::chrono::steady_clock::now();
-            m_gameThread->CreateObject("1", GameUtils::ObjectType::BOSS_PROJECTILE, "../resources/texture/animated-boss-projectile.png", "../resources/sfx/enemy-shot.wav",
-                std::bind(LogicFunctions::BossProjectileSetup, this, std::placeholders::_1, sf::Vector2i{position.x + (obj.GetSprite().getLocalBounds().getSize().x/2), position.y + (obj.GetSprite().getLocalBounds().getSize().y/2)}),
-                std::bind(LogicFunctions::BossProjectileLogic, this, std::placeholders::_1), 200ms, 1);
+            obj.StartCooldown(GameUtils::AuxTimer::PRIMARY, ticks);
+            auto spawnPosition = sf::Vector2i{position.x + (obj.GetSprite().getLocalBounds().getSize().x/2), position.y + (obj.GetSprite().getLocalBounds().getSize().y/2)};
+            m_gameThread->GetProjectilePool().Spawn(ProjectileKind::BOSS_SHOT, [&](GameUtils::Object& projectile) {
+                BossProjectileSetup(projectile, spawnPosition);
+            });
         }
 
     }
 
     void LogicFunctions::BossProjectileSetup(GameUtils::Object& obj, const sf::Vector2i& initialPos)
     {
-        auto playerPosition = std::find_if(m_gameThread->GetObjects().begin(), m_gameThread->GetObjects().end(), [](const GameUtils::Object& obj){
-                return obj.GetType() == GameUtils::ObjectType::PLAYER;
-            })->GetSprite().getPosition();
+        auto playerPosition = PlayerPosition();
 
-        obj.GetAuxiliarVars()["Direction"] = 0;
-        obj.GetAuxiliarVars()["pinMovement"] = 0;
-        obj.GetAuxiliarVars()["maximumSpacement"] = playerPosition.y - initialPos.y;
+        obj.GetAuxiliarVars()[GameUtils::AuxVar::DIRECTION] = 0;
+        obj.GetAuxiliarVars()[GameUtils::AuxVar::PIN_MOVEMENT] = 0;
+        obj.GetAuxiliarVars()[GameUtils::AuxVar::MAXIMUM_SPACEMENT] = playerPosition.y - initialPos.y;
+        obj.GetAuxiliarVars()[GameUtils::AuxVar::HIT_TEXTURE_ROW] = 0;
 
         m_gameThread->PlayAudioChannel(GameUtils::SoundName::ENEMY_SHOT); 
-        obj.GetSprite().setPosition(initialPos.x, initialPos.y);
+        obj.SetPosition(initialPos.x, initialPos.y);
     }
 
     void LogicFunctions::BossProjectileLogic(GameUtils::Object& obj)
     {
-        auto currentPosition = obj.GetSprite().getPosition();
+        auto currentPosition = obj.GetPosition();
 
-        if(currentPosition.y < m_gameThread->GetRenderWindow()->getDefaultView().getSize().y)
+        if(currentPosition.y < m_gameThread->GetViewportSize().y)
         {
-            if(obj.GetAuxiliarVars()["pinMovement"] == 0)
+            if(obj.GetAuxiliarVars()[GameUtils::AuxVar::PIN_MOVEMENT] == 0)
             {
-                std::random_device dev;
-                std::mt19937 rng(dev());
-                std::uniform_int_distribution<int> deviationAdditive(5,10);
-
-                auto playerPosition = std::find_if(m_gameThread->GetObjects().begin(), m_gameThread->GetObjects().end(), [](const GameUtils::Object& obj){
-                        return obj.GetType() == GameUtils::ObjectType::PLAYER;
-                    })->GetSprite().getPosition();
+                auto playerPosition = PlayerPosition();
                 auto ticks = static_cast<int>((playerPosition.y - currentPosition.y)/projectileVelocityBossY);
                 auto projectileVelX = static_cast<int>(std::ceil((playerPosition.x - currentPosition.x)/ticks));
 
-                obj.GetAuxiliarVars()["Direction"] = projectileVelX;
+                obj.GetAuxiliarVars()[GameUtils::AuxVar::DIRECTION] = projectileVelX;
 
-                if(std::abs(static_cast<int>(playerPosition.y - currentPosition.y)) <= (obj.GetAuxiliarVars()["maximumSpacement"]/7))
+                if(std::abs(static_cast<int>(playerPosition.y - currentPosition.y)) <= (obj.GetAuxiliarVars()[GameUtils::AuxVar::MAXIMUM_SPACEMENT]/7))
                 {
-                    obj.GetAuxiliarVars()["Direction"] = 0;
+                    obj.GetAuxiliarVars()[GameUtils::AuxVar::DIRECTION] = 0;
 
                 }
 
-                obj.GetSprite().setPosition(currentPosition.x + obj.GetAuxiliarVars()["Direction"], currentPosition.y + projectileVelocityBossY);
+                obj.SetVelocity(obj.GetAuxiliarVars()[GameUtils::AuxVar::DIRECTION], projectileVelocityBossY);
             }
+            else
+                obj.SetVelocity(0.0f, 0.0f);
         }
         else 
         {
             DestroyObject(obj);
             return;
         }
-
-        ObjectCollison(obj, {GameUtils::ObjectType::PLAYER}, GameUtils::SoundName::ENEMY_DEATH, 0);
     }
 
-    std::vector<GameUtils::Object> LogicFunctions::GetAllObjectByTypes(const std::vector<GameUtils::ObjectType>& types)
+    void LogicFunctions::ContactLogic(const GameUtils::Contact& contact)
     {
-        std::vector<GameUtils::Object> m_vector;
-        for(auto index = 0; index < m_gameThread->GetObjects().size(); ++index)
-        {
-            for(auto type : types)
-                if(m_gameThread->GetObjects()[index].GetType() == type)
-                    m_vector.push_back(m_gameThread->GetObjects()[index]);
-        }
-        return m_vector;
-    }
+        auto obj = GetObjectReference(contact.source);
+        auto enemyObj = GetObjectReference(contact.target);
+        if(obj == nullptr || enemyObj == nullptr || obj->GetDestroyOnFinish()) return;
 
-    GameUtils::Object& LogicFunctions::GetObjectReference(const GameUtils::Object& obj)
-    {
-        return *std::find(m_gameThread->GetObjects().begin(), m_gameThread->GetObjects().end(), obj);
-    }
+        const auto& rule = GameUtils::CollisionRuleOf(contact.sourceType);
+        auto textureRow = obj->GetAuxiliarVars()[GameUtils::AuxVar::HIT_TEXTURE_ROW];
 
-    void LogicFunctions::DestroyObject(const GameUtils::Object& obj)
-    {
-        m_gameThread->GetObjects().erase(std::find(m_gameThread->GetObjects().begin(), m_gameThread->GetObjects().end(), obj));
-    }
+        obj->GetAuxiliarVars()[GameUtils::AuxVar::PIN_MOVEMENT] = 1;
+        obj->SetupAnimatedAction(textureRow, false, true, false, 0, [this, obj] {
+            obj->GetAuxiliarVars()[GameUtils::AuxVar::PIN_MOVEMENT] = 0;
+        });
 
-    void LogicFunctions::ObjectCollison(GameUtils::Object& obj, const std::vector<GameUtils::ObjectType>& objTypes, const GameUtils::SoundName& soundName, const int& textureRow)
-    {
-        auto currentPosition = sf::Vector2i(obj.GetSprite().getPosition()) + obj.GetHitBox().getPosition();
-        auto enemyObjs = GetAllObjectByTypes(objTypes);
-        if(enemyObjs.size() > 0)
+        m_gameThread->PlayAudioChannel(rule.hitSound);
+        enemyObj->SetHitPoints(enemyObj->GetHitPoints() - 1);
+        if(enemyObj->GetHitPoints() <= 0)
         {
-            for(auto index = 0; index < enemyObjs.size(); ++index)
-            {
-                auto enemyPosition = sf::Vector2i(enemyObjs[index].GetSprite().getPosition()) + enemyObjs[index].GetHitBox().getPosition();
-                auto dx = (int)std::abs(currentPosition.x - enemyPosition.x);
-                auto dy = (int)std::abs(currentPosition.y - enemyPosition.y);
-                auto r = enemyObjs[index].GetHitBox().getSize().x;
-
-
-                if(!obj.GetDestroyOnFinish() && (std::pow(dx,2) + std::pow(dy, 2) <= std::pow(r, 2))) 
-                {
-                    obj.GetAuxiliarVars()["pinMovement"] = 1;
-                    obj.SetupAnimatedAction(textureRow, false, true, false, 0, [this, &obj] {
-                        obj.GetAuxiliarVars()["pinMovement"] = 0;
-                    });
-
-                    auto& objRef = GetObjectReference(enemyObjs[index]);
-                    m_gameThread->PlayAudioChannel(soundName);
-                    objRef.SetHitPoints(objRef.GetHitPoints() - 1);
-                    if(objRef.GetHitPoints() <= 0)
-                    {
-                        objRef.SetupAnimatedAction(textureRow, false, true, false, 0, [this, objTypes, objRef]() {
-                            for(auto objType : objTypes)
-                                if(objType == GameUtils::ObjectType::ENEMY)
-                                    m_gameThread->SetScore(++m_gameThread->GetScore());
-                        });
-                    }
-                }   
-            }
+            enemyObj->SetupAnimatedAction(textureRow, false, true, false, 0, [this, targetMask = rule.targetMask]() {
+                if(targetMask & GameUtils::TypeMask(GameUtils::ObjectType::ENEMY))
+                    m_gameThread->SetScore(++m_gameThread->GetScore());
+            });
         }
     }
 
-    void LogicFunctions::RandomShuffler(std::vector<int>& vector, int originalSize)
+    sf::Vector2f LogicFunctions::PlayerPosition()
     {
-        std::random_device dev;
-        std::mt19937 rng(dev());
-        if(vector.size() == 0)
-        {
-            for(auto index = 0; index < originalSize; ++index)
-                vector.push_back(index);
-        }
-        std::shuffle(vector.begin(), vector.end(), rng);
+        //Projectiles spawned on the tick the player dies still aim at its last position
+        if(auto player = GetObjectReference(m_gameThread->GetWorld().GetPlayer()); player != nullptr)
+            m_lastPlayerPosition = player->GetPosition();
+        return m_lastPlayerPosition;
     }
 
-    void LogicFunctions::PixelColorSwap(sf::Texture& texture, const std::vector<uint32_t>& oldColors, const int& newColor, const int& cycle)
+    GameUtils::Object* LogicFunctions::GetObjectReference(const GameUtils::ObjectHandle& handle)
     {
-        auto image = texture.copyToImage();
-        for(int indexY = 0; indexY < image.getSize().y; ++indexY)
-        {
-            for(int indexX = 0; indexX < image.getSize().x; ++indexX)
-            {
-                auto pixelColor = image.getPixel(indexX, indexY).toInteger();
-                auto pixelIter = std::find_if(oldColors.begin(), oldColors.end(), [this, pixelColor](const int& color)
-                {
-                    return color == pixelColor;
-                });
-                if(pixelIter != oldColors.end())
-                {
-                    if(newColor == -1)
-                    {
-                        image.setPixel(indexX, indexY, sf::Color(ColorCycling(*pixelIter, cycle)));
-                    }
-                    else
-                        image.setPixel(indexX, indexY, sf::Color(newColor));
+        return m_gameThread->GetObjects().Get(handle);
+    }
 
-                }
-            }
-        }
-        texture.loadFromImage(image);
+    void LogicFunctions::DestroyObject(const GameUtils::Object& obj)
+    {
+        m_gameThread->DestroyObject(obj);
     }
 
-    uint32_t LogicFunctions::ColorCycling(const uint32_t& color, const int& cycle)
+    int LogicFunctions::NextVolleyShooter()
     {
-        union {
-            struct {
-                unsigned B : 8;
-                unsigned G : 8;
-                unsigned R : 8;
-            };
-            uint32_t hexColor;
-        } primaryColor;
-
-        primaryColor.hexColor = color;
-        std::array<uint8_t, 3> primaryArray = {primaryColor.R, primaryColor.G, primaryColor.B};
-
-        for(auto index = 0; index <= cycle; ++index)
+        //The drawn shooter keeps the volley until it fires, it is replaced when it fired or did not run on the last tick (died)
+        auto tick = GameUtils::GetCurrentTick();
+        if(m_nextShooter < 0 || (tick != m_shooterTick && m_shooterSeenTick + 1 < tick))
         {
-            std::swap(primaryArray[1], primaryArray[0]);
-            std::swap(primaryArray[2], primaryArray[1]);
+            m_nextShooter = m_volleyShooters.Draw(GameUtils::Random::Instance().Stream(GameUtils::RandomStream::ENEMY_FIRE));
+            m_shooterSeenTick = tick;
         }
-        primaryColor.R = primaryArray[0];
-        primaryColor.G = primaryArray[1];
-        primaryColor.B = primaryArray[2];
-        return primaryColor.hexColor;
+        m_shooterTick = tick;
+        return m_nextShooter;
     }
 
-
-
-}
\ No newline at end of file
+}
@@ -9,6 +9,9 @@
 
 #include "Object/Object.h"
 #include "Sound/Sound.h"
+#include "TextureCache/TextureCache.h"
+#include "Palette/Palette.h"
+#include "Random/Random.h"
 #include "GameThread/IGameThread.h"
 
 namespace GameEngine
@@ -22,9 +25,7 @@ namespace GameEngine
     {
     public:
         LogicFunctions() = delete;
-        LogicFunctions(const std::shared_ptr<IGameThread>& gameThread) 
-            : m_gameThread(std::move(gameThread))
-        {}
+        LogicFunctions(const std::shared_ptr<IGameThread>& gameThread);
 
         void PlayerStartup(GameUtils::Object& obj, const sf::Vector2i& initialPos);
         void PlayerLogic(GameUtils::Object& obj);
@@ -38,21 +39,29 @@ namespace GameEngine
         void BossLogic(GameUtils::Object& obj);
         void BossProjectileSetup(GameUtils::Object& obj, const sf::Vector2i& initialPos);
         void BossProjectileLogic(GameUtils::Object& obj);
+        void ContactLogic(const GameUtils::Contact& contact);
+        // Builds every palette variant up front so spawning recolored objects does no pixel work
+        void PrewarmVariants();
+        // Fills one pool per projectile kind, spawning afterwards only revives pooled objects
+        void RegisterProjectiles(ProjectilePool& pool);
 
     private:
         std::mutex m_mutex;
         std::shared_ptr<IGameThread> m_gameThread;
-        std::chrono::time_point<std::chrono::steady_clock> m_auxiliarTimestamp;
-        std::vector<int> m_randomPos;
-        int m_enemyQnt;
+        // Tick of the last enemy volley, the next one waits for the flight time of the current shooter
+        GameUtils::Tick m_volleyTick = 0;
+        sf::Vector2f m_lastPlayerPosition;
+        GameUtils::ShuffleBag m_volleyShooters;
+        GameUtils::Tick m_shooterTick = 0;
+        GameUtils::Tick m_shooterSeenTick = 0;
+        int m_nextShooter = -1;
+        std::vector<GameUtils::Palette> m_enemyPalettes;
+        GameUtils::Palette m_bossProjectilePalette;
 
-        std::vector<GameUtils::Object> GetAllObjectByTypes(const std::vector<GameUtils::ObjectType>& types);
-        GameUtils::Object& GetObjectReference(const GameUtils::Object& obj);
+        sf::Vector2f PlayerPosition();
+        GameUtils::Object* GetObjectReference(const GameUtils::ObjectHandle& handle);
         void DestroyObject(const GameUtils::Object& obj);
-        void ObjectCollison(GameUtils::Object& obj, const std::vector<GameUtils::ObjectType>& objTypes, const GameUtils::SoundName& soundName, const int& textureRow = 0);
-        void RandomShuffler(std::vector<int>& vector, int originalSize);
-        void PixelColorSwap(sf::Texture& texture, const std::vector<uint32_t>& oldColors, const int& newColor = -1, const int& cycle = 0);
-        uint32_t ColorCycling(const uint32_t& color, const int& cycle);
+        int NextVolleyShooter();
     };
 
 
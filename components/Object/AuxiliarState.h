@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace GameUtils
+{
+    // Per-object behavior fields, every logic handler picks the ones it needs
+    enum class AuxVar : int
+    {
+        MOVEMENT_COUNTER = 0,
+        BASE_VELOCITY_X,
+        PIN_MOVEMENT,
+        HIT_TEXTURE_ROW,
+        DIRECTION,
+        MUTABLE_PROJECTILE_VELOCITY,
+        MAXIMUM_SPACEMENT,
+        BULLET_POSITION,
+        BULLET_OFFSET_0,
+        BULLET_OFFSET_1,
+        BULLET_OFFSET_2,
+        COUNT
+    };
+
+    enum class AuxTimer : int
+    {
+        PRIMARY = 0,
+        SECOND,
+        COUNT
+    };
+
+    // Flat storage indexed by an enum, each access is a fixed offset. Values start zeroed.
+    template<typename Key, typename Value>
+    class EnumArray
+    {
+    public:
+        Value& operator[](const Key& key)
+        {
+            return m_values[static_cast<std::size_t>(key)];
+        }
+
+        const Value& operator[](const Key& key) const
+        {
+            return m_values[static_cast<std::size_t>(key)];
+        }
+
+    private:
+        std::array<Value, static_cast<std::size_t>(Key::COUNT)> m_values{};
+    };
+
+    constexpr AuxVar BulletOffset(const int& bulletPosition)
+    {
+        return static_cast<AuxVar>(static_cast<int>(AuxVar::BULLET_OFFSET_0) + bulletPosition);
+    }
+}
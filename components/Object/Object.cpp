@@ -1,9 +1,12 @@
+#include <algorithm>
+
 #include "Object.h"
+#include "ObjectStore/EntityColumns.h"
 
 namespace GameUtils
 {
     Object::Object(const std::string& id, const ObjectType& objType, const std::string& texturePath, const std::string& soundPath, const std::function<void(GameUtils::Object&)>& startupHandler, const std::function<void(GameUtils::Object&)>& logicHandler, const std::chrono::milliseconds& animationFrametime, const int& hitPoints, const int& scorePoint) : 
-            m_id(id), m_objType(objType), m_soundBufferPath(soundPath), m_startupHandler(startupHandler), m_logicHandler(logicHandler), m_animationFrametime(animationFrametime), m_hitPoints(hitPoints), m_scorePoint(scorePoint)
+            m_id(id), m_texturePath(texturePath), m_soundBufferPath(soundPath), m_objType(objType), m_startupHandler(startupHandler), m_logicHandler(logicHandler), m_animationFrametime(animationFrametime), m_hitPoints(hitPoints), m_spawnHitPoints(hitPoints), m_scorePoint(scorePoint)
         {
             if(m_id != "UNKNOWN")
             {             
@@ -15,27 +18,29 @@ namespace GameUtils
                     {ObjectType::BOSS, sf::IntRect{{11,20}, {105, 84}}},
                     {ObjectType::BOSS_PROJECTILE, sf::IntRect{{7,8}, {18, 15}}},
                 };
-                m_objTexture = std::make_shared<sf::Texture>();
-                m_objTexture->loadFromFile(texturePath);
-                m_objSprite.setTexture(*m_objTexture);
                 auto [textureWidth, textureHeigth] = TextureSizeFromObjectType(objType);
-                m_objSprite.setTextureRect(sf::IntRect{sf::Vector2i{0,0}, sf::Vector2i{textureWidth,textureHeigth}});
-                
-                if(soundPath != "")
+                m_renderRectSize = {textureWidth, textureHeigth};
+                m_atlasSprite = TextureAtlas::Instance().Find(texturePath);
+                if(m_atlasSprite != nullptr)
+                {
+                    m_objTexture = m_atlasSprite->page;
+                    m_textureSize = sf::Vector2u(m_atlasSprite->rect.getSize());
+                    m_renderRectSize = m_atlasSprite->frameSize;
+                }
+                else
                 {
-                    m_objSoundBuffer = std::make_shared<sf::SoundBuffer>();
-                    m_objSoundBuffer->loadFromFile(soundPath);
-                    m_objSound.setBuffer(*m_objSoundBuffer);
+                    m_objTexture = TextureCache::Instance().Get(texturePath);
+                    m_textureSize = TextureCache::Instance().GetTextureSize(texturePath);
                 }
+                if(m_objTexture != nullptr)
+                    m_objSprite.setTexture(*m_objTexture);
+                m_objSprite.setTextureRect(FrameRect(0, 0));
 
                 m_currentRenderRect = m_objSprite.getTextureRect();
-                m_textureSize = m_objSprite.getTexture()->getSize();
-                m_renderRectSize = m_currentRenderRect.getSize();
                 m_frameQuantity = m_textureSize.x/m_renderRectSize.x;
                 m_animationHead = 0;
                 m_destroyOnFinish = false;
                 m_destroy = false;
-                m_auxiliarTimestamps["Primary"] = std::chrono::steady_clock::now();
                 m_startupHandler(*this);
                 m_hitBox = hitBoxMap[objType];
             }
@@ -47,24 +52,124 @@ namespace GameUtils
             return m_id;
         }
 
+        ObjectHandle Object::GetHandle() const
+        {
+            return m_handle;
+        }
+
+        void Object::SetHandle(const ObjectHandle& handle)
+        {
+            m_handle = handle;
+        }
+
         sf::Sprite& Object::GetSprite() 
         {
             return m_objSprite;
         }
 
-        std::shared_ptr<sf::Texture>& Object::GetTexture()
+        sf::Vector2f Object::GetPosition() const
+        {
+            if(m_columns == nullptr) return m_position;
+            return {m_columns->positionX[m_handle.index], m_columns->positionY[m_handle.index]};
+        }
+
+        void Object::SetPosition(const float& x, const float& y)
+        {
+            if(m_columns == nullptr)
+                m_position = {x, y};
+            else
+                m_columns->SetPosition(m_handle.index, x, y);
+        }
+
+        sf::Vector2f Object::GetVelocity() const
+        {
+            if(m_columns == nullptr) return m_velocity;
+            return {m_columns->velocityX[m_handle.index], m_columns->velocityY[m_handle.index]};
+        }
+
+        void Object::SetVelocity(const float& x, const float& y)
+        {
+            if(m_columns == nullptr)
+            {
+                m_velocity = {x, y};
+                return;
+            }
+            m_columns->velocityX[m_handle.index] = x;
+            m_columns->velocityY[m_handle.index] = y;
+        }
+
+        void Object::BindColumns(EntityColumns* columns)
+        {
+            //Leaving the world, the last values are kept on the object
+            if(m_columns != nullptr && columns == nullptr)
+            {
+                m_position = GetPosition();
+                m_velocity = GetVelocity();
+                m_hitPoints = GetHitPoints();
+            }
+            m_columns = columns;
+        }
+
+        const std::shared_ptr<const sf::Texture>& Object::GetTexture() const
         {
             return m_objTexture;
         }
 
-        std::string Object::GetDefaultSoundFilePath()
+        void Object::SetTexture(const std::shared_ptr<const sf::Texture>& texture)
         {
-            return m_soundBufferPath;
+            //A standalone texture replaces the atlas page, the current frame is rebased to its origin
+            auto currentRect = m_objSprite.getTextureRect();
+            if(m_atlasSprite != nullptr)
+            {
+                currentRect.left -= m_atlasSprite->rect.left;
+                currentRect.top -= m_atlasSprite->rect.top;
+                m_atlasSprite = nullptr;
+            }
+            m_objTexture = texture;
+            if(m_objTexture != nullptr)
+                m_objSprite.setTexture(*m_objTexture);
+            m_objSprite.setTextureRect(currentRect);
+        }
+
+        std::string Object::GetTexturePath() const
+        {
+            return m_texturePath;
         }
 
-        sf::Sound& Object::GetSound()
+        void Object::SetPalette(const Palette& palette)
         {
-            return m_objSound;
+            auto variant = m_atlasSprite != nullptr ? TextureAtlas::Instance().FindVariant(m_texturePath, palette) : nullptr;
+            if(variant == nullptr)
+            {
+                SetTexture(PaletteTexture(m_texturePath, palette));
+                return;
+            }
+
+            //Same frame layout in the variant page, the current frame is rebased onto it
+            auto currentRect = m_objSprite.getTextureRect();
+            if(currentRect == m_atlasSprite->empty)
+                currentRect = variant->empty;
+            else
+            {
+                currentRect.left += variant->rect.left - m_atlasSprite->rect.left;
+                currentRect.top += variant->rect.top - m_atlasSprite->rect.top;
+            }
+            m_atlasSprite = variant;
+            m_objTexture = variant->page;
+            m_objSprite.setTexture(*m_objTexture);
+            m_objSprite.setTextureRect(currentRect);
+        }
+
+        std::shared_ptr<const sf::Texture> Object::PaletteTexture(const std::string& texturePath, const Palette& palette)
+        {
+            if(auto variant = TextureAtlas::Instance().FindVariant(texturePath, palette); variant != nullptr)
+                return variant->page;
+            return TextureCache::Instance().GetPalette(texturePath, palette);
+        }
+
+        std::string Object::GetDefaultSoundFilePath()
+        {
+            return m_soundBufferPath;
         }
 
         ObjectType Object::GetType() const
@@ -79,30 +184,35 @@ namespace GameUtils
 
         void Object::SetTimer(const std::chrono::milliseconds& time, const bool& continous)
         {
-            if(time == 0ms)
-            {
-                m_timer.reset();
-                m_timer = nullptr;
-                return;
-            }
-            m_timer = std::make_shared<std::tuple<std::chrono::milliseconds, std::chrono::steady_clock::time_point, bool>>(time, std::chrono::steady_clock::now(), continous);
+            TimerWheel::Instance().Cancel(m_timer);
+            m_timerPeriod = time == 0ms ? 0 : MillisecondsToTicks(time);
+            m_timerContinous = continous;
+            if(m_timerPeriod > 0)
+                m_timer = TimerWheel::Instance().Schedule(m_timerPeriod);
         }
 
         bool Object::TimerOverflown() 
         {
-            if(m_timer == nullptr) 
+            if(m_timerPeriod == 0 || TimerWheel::Instance().IsActive(m_timer)) 
             {
                 return false;
             }
 
-            auto [time, timer, continous] = *m_timer;
-            if(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - timer) >= time)
-            {
-                if(continous)
-                    m_timer = std::make_shared<std::tuple<std::chrono::milliseconds, std::chrono::steady_clock::time_point, bool>>(time, std::chrono::steady_clock::now(), continous);
-                return true;
-            }
-            return false;
+            if(m_timerContinous)
+                m_timer = TimerWheel::Instance().Schedule(m_timerPeriod);
+            return true;
+        }
+
+        void Object::StartCooldown(const AuxTimer& timer, const int& ticks)
+        {
+            auto& handle = m_auxiliarTimers[timer];
+            TimerWheel::Instance().Cancel(handle);
+            handle = TimerWheel::Instance().Schedule(static_cast<Tick>(std::max(ticks, 0)));
+        }
+
+        bool Object::CooldownReady(const AuxTimer& timer) const
+        {
+            return !TimerWheel::Instance().IsActive(m_auxiliarTimers[timer]);
         }
 
         void Object::SetupAnimatedAction(const int& textureRow, const bool& isLoop, const bool& destroyOnFinish, const bool& onFinishRollback, const int& rollbackTextureRow, const std::function<void()>& destroyAction)
@@ -110,38 +220,41 @@ namespace GameUtils
             m_textureRow = textureRow;
             m_isLoop = isLoop;
             m_animRunning = true;
-            m_animationStartTime = std::chrono::steady_clock::now();
             m_animationStep = 1;
             m_destroyOnFinish = destroyOnFinish;
             m_onFinishRollback = onFinishRollback;
             m_destroyAction = destroyAction;
             m_previousTextureRow = rollbackTextureRow;
+            RestartAnimationTimer();
         }
 
         void Object::DoAnimatedAction()
         {
-            if(!m_animRunning) return;
-            auto animationFramePeriod = m_animationFrametime/(int)m_frameQuantity;
-            if(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_animationStartTime) > animationFramePeriod)
+            if(!m_animRunning || TimerWheel::Instance().IsActive(m_animationTimer)) return;
+            if(m_animationStep == m_frameQuantity) 
             {
-                    if(m_animationStep == m_frameQuantity) 
+                m_animationStep = 0;
+                if(!m_isLoop)
+                {
+                    m_animRunning = false;
+                    if(m_destroyOnFinish)
                     {
-                        m_animationStep = 0;
-                        if(!m_isLoop)
-                        {
-                            m_animRunning = false;
-                            if(m_destroyOnFinish)
-                            {
-                                m_destroy = true;
-                                m_destroyAction();
-                            }
-                            if(m_onFinishRollback)
-                                SetupAnimatedAction(m_previousTextureRow, true);
-                        }
+                        m_destroy = true;
+                        m_destroyAction();
                     }
-                    m_animationStartTime = std::chrono::steady_clock::now();
-                    m_objSprite.setTextureRect(sf::IntRect{sf::Vector2i{(int)(m_animationStep++ * m_renderRectSize.x), m_textureRow * m_renderRectSize.y}, m_currentRenderRect.getSize()});
+                    if(m_onFinishRollback)
+                        SetupAnimatedAction(m_previousTextureRow, true);
+                }
             }
+            RestartAnimationTimer();
+            m_objSprite.setTextureRect(FrameRect(m_textureRow, m_animationStep++));
+        }
+
+        void Object::RestartAnimationTimer()
+        {
+            TimerWheel::Instance().Cancel(m_animationTimer);
+            if(m_frameQuantity == 0) return;
+            m_animationTimer = TimerWheel::Instance().Schedule(MillisecondsToTicks(m_animationFrametime/(int)m_frameQuantity));
         }
 
         void Object::StopAnimatedAction()
@@ -149,6 +262,38 @@ namespace GameUtils
             m_animRunning = 0;
         }
 
+        void Object::CancelTimers()
+        {
+            TimerWheel::Instance().Cancel(m_timer);
+            TimerWheel::Instance().Cancel(m_animationTimer);
+            for(auto timer = 0; timer < static_cast<int>(AuxTimer::COUNT); ++timer)
+                TimerWheel::Instance().Cancel(m_auxiliarTimers[static_cast<AuxTimer>(timer)]);
+        }
+
+        void Object::Recycle()
+        {
+            CancelTimers();
+            m_auxiliarTimers = {};
+            m_auxiliarVariables = {};
+            m_timerPeriod = 0;
+            m_timerContinous = false;
+            m_hitPoints = m_spawnHitPoints;
+            m_velocity = {0.0f, 0.0f};
+
+            m_animRunning = false;
+            m_animationHead = 0;
+            m_animationStep = 0;
+            m_textureRow = 0;
+            m_previousTextureRow = 0;
+            m_isLoop = false;
+            m_destroyOnFinish = false;
+            m_destroy = false;
+            m_onFinishRollback = false;
+            m_destroyAction = nullptr;
+            m_objSprite.setTextureRect(FrameRect(0, 0));
+            m_currentRenderRect = m_objSprite.getTextureRect();
+        }
+
         bool Object::GetDestroy()
         {
             return m_destroy;
@@ -159,29 +304,28 @@ namespace GameUtils
             return m_destroyOnFinish;
         }
 
-        sf::IntRect Object::GetHitBox()
+        sf::IntRect Object::GetHitBox() const
         {
             return m_hitBox;
         }
 
-        std::map<std::string, int>& Object::GetAuxiliarVars()
+        AuxiliarVars& Object::GetAuxiliarVars()
         {
             return m_auxiliarVariables;
         }
 
-        std::map<std::string, std::chrono::time_point<std::chrono::steady_clock>>& Object::GetAuxiliarTimeStamp()
-        {
-            return m_auxiliarTimestamps;
-        }
-
         int Object::GetHitPoints() const
         {
-            return m_hitPoints;
+            if(m_columns == nullptr) return m_hitPoints;
+            return m_columns->hitPoints[m_handle.index];
         }
 
         void Object::SetHitPoints(const int& value)
         {
-            m_hitPoints = value;
+            if(m_columns == nullptr)
+                m_hitPoints = value;
+            else
+                m_columns->hitPoints[m_handle.index] = value;
         }
 
         bool Object::GetAnimRunning()
@@ -189,11 +333,28 @@ namespace GameUtils
             return m_animRunning;
         }
 
+        int Object::GetAnimationRow() const
+        {
+            return m_textureRow;
+        }
+
+        unsigned int Object::GetAnimationFrame() const
+        {
+            return m_animationStep;
+        }
+
         void Object::StepLogic()
         {
             m_logicHandler(*this);
         }
 
+        sf::IntRect Object::FrameRect(const int& row, const int& frame) const
+        {
+            if(m_atlasSprite != nullptr)
+                return m_atlasSprite->FrameRect(row, frame);
+            return sf::IntRect{sf::Vector2i{frame * m_renderRectSize.x, row * m_renderRectSize.y}, m_renderRectSize};
+        }
+
         std::pair<int,int> Object::TextureSizeFromObjectType(const ObjectType& type)
         {
             switch(type)
@@ -11,11 +11,23 @@
 #include "SFML/Graphics.hpp"
 #include "SFML/Audio.hpp"
 
+#include "TextureCache/TextureCache.h"
+#include "TextureAtlas/TextureAtlas.h"
+#include "ObjectStore/ObjectHandle.h"
+#include "GameUtils/GameUtils.h"
+#include "AuxiliarState.h"
+#include "TimerWheel/TimerWheel.h"
+
 using namespace std::chrono_literals;
 
 namespace GameUtils
 {
 
+    struct EntityColumns;
+
+    using AuxiliarVars = EnumArray<AuxVar, int>;
+    using AuxiliarTimers = EnumArray<AuxTimer, TimerHandle>;
+
     enum class ObjectType : int
     {
         UNKNOWN = 0,
@@ -56,52 +68,85 @@ namespace GameUtils
 
         constexpr bool operator==(const Object& other) const 
         {
-            return (m_id == other.m_id) &&
-                    (m_objType == other.m_objType);
+            return m_handle == other.m_handle;
         }
 
 
         static std::pair<int,int> TextureSizeFromObjectType(const ObjectType& type);
 
         std::string GetId() const;
+        ObjectHandle GetHandle() const;
+        void SetHandle(const ObjectHandle& handle);
+        // Texture and frame of the object, its position lives in the store's columns and is applied when a snapshot is built
         sf::Sprite& GetSprite();
-        std::shared_ptr<sf::Texture>& GetTexture();
+        // Position, velocity and hit points are read from and written to the store's columns while the object is in the world.
+        // Before that, in startup handlers and pooled setups, they are kept on the object and taken in when it joins.
+        sf::Vector2f GetPosition() const;
+        void SetPosition(const float& x, const float& y);
+        sf::Vector2f GetVelocity() const;
+        // Displacement the store's movement pass applies on every following tick
+        void SetVelocity(const float& x, const float& y);
+        // Called by the store when the object joins the world, and with nullptr when it leaves
+        void BindColumns(EntityColumns* columns);
+        const std::shared_ptr<const sf::Texture>& GetTexture() const;
+        void SetTexture(const std::shared_ptr<const sf::Texture>& texture);
+        std::string GetTexturePath() const;
+        // Binds the palette variant of the object's sheet in the shared variant page, or a recolored copy of its own
+        // texture when it is not atlased
+        void SetPalette(const Palette& palette);
+        // Texture the variant of texturePath is drawn from, building the variant on first use
+        static std::shared_ptr<const sf::Texture> PaletteTexture(const std::string& texturePath, const Palette& palette);
         std::string GetDefaultSoundFilePath();
-        sf::Sound& GetSound();
         ObjectType GetType() const;
         std::chrono::milliseconds GetAnimationFrametime() const;
         void SetTimer(const std::chrono::milliseconds& time, const bool& continous);
         bool TimerOverflown();
+        // Cooldowns live in the TimerWheel, an object only keeps the handle and polls it
+        void StartCooldown(const AuxTimer& timer, const int& ticks);
+        bool CooldownReady(const AuxTimer& timer) const;
         int GetHitPoints() const;
         void SetHitPoints(const int& value);
         bool GetAnimRunning();
+        int GetAnimationRow() const;
+        unsigned int GetAnimationFrame() const;
         void StepLogic();
         void SetupAnimatedAction(const int& textureRow, const bool& isLoop, const bool& destroyOnFinish = false, const bool& onFinishRollback = false, const int& rollbackTextureRow = 0, const std::function<void()>& destroyAction = []{});
         void DoAnimatedAction();
         void StopAnimatedAction();
+        // Brings a pooled object back to its freshly constructed state: timers cancelled, animation and auxiliar state cleared.
+        // Texture, palette and handlers are kept, so reviving it needs no loading and no allocation.
+        void Recycle();
+        // Cancels every wheel timer of the object, called by the store before the object is released or recycled
+        void CancelTimers();
         bool GetDestroy();
         bool GetDestroyOnFinish();
-        sf::IntRect GetHitBox();
-        std::map<std::string, int>& GetAuxiliarVars();
-        std::map<std::string, std::chrono::time_point<std::chrono::steady_clock>>& GetAuxiliarTimeStamp();
+        sf::IntRect GetHitBox() const;
+        AuxiliarVars& GetAuxiliarVars();
 
     private:
         std::string m_id;
+        ObjectHandle m_handle;
+        std::string m_texturePath;
         std::string m_soundBufferPath;
         ObjectType m_objType;
         std::function<void(GameUtils::Object&)> m_startupHandler;
         std::function<void(GameUtils::Object&)> m_logicHandler;
-        std::shared_ptr<sf::Texture> m_objTexture;
-        std::shared_ptr<sf::SoundBuffer> m_objSoundBuffer;
+        std::shared_ptr<const sf::Texture> m_objTexture;
+        const AtlasSprite* m_atlasSprite = nullptr;
         sf::Sprite m_objSprite;
-        sf::Sound m_objSound;
         std::chrono::milliseconds m_animationFrametime;
-        std::shared_ptr<std::tuple<std::chrono::milliseconds, std::chrono::steady_clock::time_point, bool>> m_timer;
+        TimerHandle m_timer;
+        Tick m_timerPeriod = 0;
+        bool m_timerContinous = false;
         int m_hitPoints;
-        std::map<std::string, int> m_auxiliarVariables;
-        std::map<std::string, std::chrono::time_point<std::chrono::steady_clock>> m_auxiliarTimestamps;
+        int m_spawnHitPoints;
+        AuxiliarVars m_auxiliarVariables;
+        AuxiliarTimers m_auxiliarTimers;
         int m_scorePoint;
         sf::IntRect m_hitBox;
+        EntityColumns* m_columns = nullptr;
+        sf::Vector2f m_position;
+        sf::Vector2f m_velocity;
 
 
         //TODO Animation class?
@@ -110,17 +155,20 @@ namespace GameUtils
         sf::IntRect m_currentRenderRect;
         sf::Vector2u m_textureSize;
         sf::Vector2i m_renderRectSize;
-        unsigned int m_frameQuantity;
+        unsigned int m_frameQuantity = 0;
         unsigned int m_animationHead;
-        unsigned int m_animationStep;
-        std::chrono::_V2::steady_clock::time_point m_animationStartTime;
-        int m_textureRow;
+        unsigned int m_animationStep = 0;
+        TimerHandle m_animationTimer;
+        int m_textureRow = 0;
         int m_previousTextureRow;
         bool m_isLoop;
         bool m_destroyOnFinish;
         bool m_destroy;
         std::function<void()> m_destroyAction;
         bool m_onFinishRollback;
+
+        sf::IntRect FrameRect(const int& row, const int& frame) const;
+        void RestartAnimationTimer();
         // --------------------------------
     };
 }
\ No newline at end of file
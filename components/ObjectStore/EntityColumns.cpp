@@ -0,0 +1,82 @@
+#include <algorithm>
+
+#include "EntityColumns.h"
+
+namespace GameUtils
+{
+    std::size_t EntityColumns::Size() const
+    {
+        return alive.size();
+    }
+
+    void EntityColumns::Resize(const std::size_t& size)
+    {
+        positionX.resize(size);
+        positionY.resize(size);
+        velocityX.resize(size);
+        velocityY.resize(size);
+        hitBoxOffsetX.resize(size);
+        hitBoxOffsetY.resize(size);
+        hitBoxX.resize(size);
+        hitBoxY.resize(size);
+        hitBoxWidth.resize(size);
+        hitBoxHeight.resize(size);
+        type.resize(size, ObjectType::UNKNOWN);
+        hitPoints.resize(size);
+        alive.resize(size);
+    }
+
+    void EntityColumns::Insert(const uint32_t& index, const Object& object)
+    {
+        if(index >= Size())
+            Resize(index + 1);
+        auto position = object.GetPosition();
+        auto velocity = object.GetVelocity();
+        auto hitBox = object.GetHitBox();
+
+        velocityX[index] = velocity.x;
+        velocityY[index] = velocity.y;
+        hitBoxOffsetX[index] = hitBox.left;
+        hitBoxOffsetY[index] = hitBox.top;
+        hitBoxWidth[index] = hitBox.width;
+        hitBoxHeight[index] = hitBox.height;
+        SetPosition(index, position.x, position.y);
+        type[index] = object.GetType();
+        hitPoints[index] = object.GetHitPoints();
+        alive[index] = 1;
+    }
+
+    void EntityColumns::SetPosition(const uint32_t& index, const float& x, const float& y)
+    {
+        positionX[index] = x;
+        positionY[index] = y;
+        hitBoxX[index] = static_cast<int>(x) + hitBoxOffsetX[index];
+        hitBoxY[index] = static_cast<int>(y) + hitBoxOffsetY[index];
+    }
+
+    void EntityColumns::Move()
+    {
+        //Dead and parked slots are moved as well, it keeps the loop branch free and they are overwritten on Insert
+        auto size = Size();
+        for(std::size_t index = 0; index < size; ++index)
+        {
+            positionX[index] += velocityX[index];
+            positionY[index] += velocityY[index];
+            hitBoxX[index] = static_cast<int>(positionX[index]) + hitBoxOffsetX[index];
+            hitBoxY[index] = static_cast<int>(positionY[index]) + hitBoxOffsetY[index];
+        }
+    }
+
+    void EntityColumns::Erase(const uint32_t& index)
+    {
+        if(index >= Size()) return;
+        alive[index] = 0;
+        type[index] = ObjectType::UNKNOWN;
+    }
+
+    void EntityColumns::Clear()
+    {
+        std::fill(alive.begin(), alive.end(), 0);
+        std::fill(type.begin(), type.end(), ObjectType::UNKNOWN);
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#include "Object/Object.h"
+
+namespace GameUtils
+{
+    // Hot per-object fields laid out as one contiguous array per component, indexed by ObjectHandle::index.
+    // Position, velocity and hit points of a live object are stored here only, its Object reads and writes them through.
+    struct EntityColumns
+    {
+        std::vector<float> positionX;
+        std::vector<float> positionY;
+        // Displacement applied by Move on every tick until logic changes it
+        std::vector<float> velocityX;
+        std::vector<float> velocityY;
+        // Hitbox offset within the sprite, and the hitbox in world space kept in step with the position
+        std::vector<int> hitBoxOffsetX;
+        std::vector<int> hitBoxOffsetY;
+        std::vector<int> hitBoxX;
+        std::vector<int> hitBoxY;
+        std::vector<int> hitBoxWidth;
+        std::vector<int> hitBoxHeight;
+        std::vector<ObjectType> type;
+        std::vector<int> hitPoints;
+        std::vector<uint8_t> alive;
+
+        std::size_t Size() const;
+        void Resize(const std::size_t& size);
+        // Takes in the position, velocity and hit points the object held before joining the world
+        void Insert(const uint32_t& index, const Object& object);
+        void SetPosition(const uint32_t& index, const float& x, const float& y);
+        // Movement pass: adds every velocity to its position and refreshes the world hitboxes
+        void Move();
+        void Erase(const uint32_t& index);
+        void Clear();
+    };
+}
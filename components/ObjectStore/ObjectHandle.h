@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace GameUtils
+{
+    // Index of a slot in the ObjectStore plus the generation it was issued for, stale handles never resolve.
+    struct ObjectHandle
+    {
+        static constexpr uint32_t invalidIndex = std::numeric_limits<uint32_t>::max();
+
+        uint32_t index = invalidIndex;
+        uint32_t generation = 0;
+
+        constexpr bool IsValid() const
+        {
+            return index != invalidIndex;
+        }
+
+        constexpr bool operator==(const ObjectHandle& other) const = default;
+    };
+}
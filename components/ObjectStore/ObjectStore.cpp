@@ -0,0 +1,164 @@
+#include <algorithm>
+
+#include "ObjectStore.h"
+
+namespace GameUtils
+{
+    void ObjectStore::Destroy(const ObjectHandle& handle)
+    {
+        if(!Contains(handle)) return;
+        auto& slot = m_slots[handle.index];
+        slot.pendingDestroy = true;
+        m_columns.Erase(handle.index);
+        ++m_pendingCount;
+        --m_size;
+
+        //Only when a tracked object dies while others of its type live, the replacement is searched for
+        auto type = slot.object->GetType();
+        if(m_world.OnDestroy(type, handle))
+        {
+            for(auto& object : *this)
+            {
+                if(object.GetType() == type)
+                    m_world.SetTracked(type, object.GetHandle());
+            }
+        }
+    }
+
+    void ObjectStore::Flush()
+    {
+        if(m_pendingCount == 0) return;
+
+        auto liveEnd = std::remove_if(m_live.begin(), m_live.end(), [this](const uint32_t& index) {
+            if(!m_slots[index].pendingDestroy) return false;
+            Release(index);
+            return true;
+        });
+        m_live.erase(liveEnd, m_live.end());
+        m_pendingCount = 0;
+    }
+
+    void ObjectStore::Clear()
+    {
+        for(auto index : m_live)
+            Release(index);
+        m_live.clear();
+        m_columns.Clear();
+        m_world.Clear();
+        m_size = 0;
+        m_pendingCount = 0;
+    }
+
+    void ObjectStore::Move()
+    {
+        m_columns.Move();
+    }
+
+    const EntityColumns& ObjectStore::GetColumns() const
+    {
+        return m_columns;
+    }
+
+    const WorldQuery& ObjectStore::GetWorld() const
+    {
+        return m_world;
+    }
+
+    Object* ObjectStore::Get(const ObjectHandle& handle)
+    {
+        if(!Contains(handle)) return nullptr;
+        return &*m_slots[handle.index].object;
+    }
+
+    ObjectHandle ObjectStore::GetHandle(const uint32_t& index) const
+    {
+        if(index >= m_slots.size()) return ObjectHandle{};
+        return ObjectHandle{index, m_slots[index].generation};
+    }
+
+    bool ObjectStore::Contains(const ObjectHandle& handle) const
+    {
+        if(!handle.IsValid() || handle.index >= m_slots.size()) return false;
+        const auto& slot = m_slots[handle.index];
+        return slot.generation == handle.generation && slot.object.has_value() && !slot.pendingDestroy && !slot.parked;
+    }
+
+    std::size_t ObjectStore::ParkedCount(const PoolId& pool) const
+    {
+        return pool < m_parked.size() ? m_parked[pool].size() : 0;
+    }
+
+    std::size_t ObjectStore::Size() const
+    {
+        return m_size;
+    }
+
+    bool ObjectStore::Empty() const
+    {
+        return m_size == 0;
+    }
+
+    ObjectStore::Iterator ObjectStore::begin()
+    {
+        return Iterator(this, 0, m_live.size());
+    }
+
+    ObjectStore::Iterator ObjectStore::end()
+    {
+        return Iterator(this, m_live.size(), m_live.size());
+    }
+
+    uint32_t ObjectStore::AcquireSlot()
+    {
+        if(!m_freeSlots.empty())
+        {
+            auto index = m_freeSlots.back();
+            m_freeSlots.pop_back();
+            return index;
+        }
+        m_slots.emplace_back();
+        return static_cast<uint32_t>(m_slots.size() - 1);
+    }
+
+    void ObjectStore::Activate(const uint32_t& index)
+    {
+        auto& slot = m_slots[index];
+        auto& object = *slot.object;
+        object.SetHandle(ObjectHandle{index, slot.generation});
+        m_columns.Insert(index, object);
+        object.BindColumns(&m_columns);
+        m_world.OnCreate(object.GetType(), object.GetHandle());
+        m_live.push_back(index);
+        ++m_size;
+    }
+
+    void ObjectStore::Park(const uint32_t& index)
+    {
+        auto& slot = m_slots[index];
+        slot.parked = true;
+        if(slot.pool >= m_parked.size())
+            m_parked.resize(slot.pool + 1);
+        m_parked[slot.pool].push_back(index);
+        //Columns are sized now so reviving never grows them
+        if(index >= m_columns.Size())
+            m_columns.Resize(index + 1);
+    }
+
+    void ObjectStore::Release(const uint32_t& index)
+    {
+        auto& slot = m_slots[index];
+        slot.pendingDestroy = false;
+        ++slot.generation;
+        slot.object->BindColumns(nullptr);
+        if(slot.pool != noPool)
+        {
+            slot.object->Recycle();
+            Park(index);
+            return;
+        }
+        //Timers left on the wheel would outlive the object and fill the wheel with dead entries
+        slot.object->CancelTimers();
+        slot.object.reset();
+        m_freeSlots.push_back(index);
+    }
+}
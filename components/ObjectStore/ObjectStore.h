@@ -0,0 +1,144 @@
+#pragma once
+
+#include <deque>
+#include <vector>
+#include <optional>
+#include <iterator>
+#include <cstddef>
+
+#include "ObjectHandle.h"
+#include "EntityColumns.h"
+#include "WorldQuery.h"
+#include "Object/Object.h"
+
+namespace GameUtils
+{
+    using PoolId = uint8_t;
+    constexpr PoolId noPool = 0xFF;
+
+    // Slot map of Objects: handles and references stay valid across insertion, destruction is deferred to Flush.
+    class ObjectStore
+    {
+    public:
+        // Visits the objects live when the loop started, objects created during the loop are visited by the next one.
+        // The end is captured with the iterator so pending objects appended meanwhile are never skipped past it.
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = Object;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Object*;
+            using reference = Object&;
+
+            Iterator() = default;
+            Iterator(ObjectStore* store, const std::size_t& position, const std::size_t& end) : m_store(store), m_position(position), m_end(end)
+            {
+                SkipPending();
+            }
+
+            reference operator*() const { return *m_store->m_slots[m_store->m_live[m_position]].object; }
+            pointer operator->() const { return &**this; }
+            Iterator& operator++() { ++m_position; SkipPending(); return *this; }
+            Iterator operator++(int) { auto previous = *this; ++*this; return previous; }
+            bool operator==(const Iterator& other) const { return m_position == other.m_position; }
+
+        private:
+            ObjectStore* m_store = nullptr;
+            std::size_t m_position = 0;
+            std::size_t m_end = 0;
+
+            void SkipPending()
+            {
+                while(m_position < m_end && m_store->m_slots[m_store->m_live[m_position]].pendingDestroy)
+                    ++m_position;
+            }
+        };
+
+        ObjectStore() = default;
+        ObjectStore(const ObjectStore&) = delete;
+        ObjectStore& operator=(const ObjectStore&) = delete;
+
+        template<typename... Args>
+        Object& Create(Args&&... args)
+        {
+            auto index = AcquireSlot();
+            auto& object = m_slots[index].object.emplace(std::forward<Args>(args)...);
+            Activate(index);
+            return object;
+        }
+
+        // Pooled objects are constructed once and parked out of the world. Destroying one parks it again on Flush
+        // instead of releasing it, and Revive hands it back without constructing or allocating anything.
+        template<typename... Args>
+        void CreateParked(const PoolId& pool, Args&&... args)
+        {
+            auto index = AcquireSlot();
+            auto& slot = m_slots[index];
+            slot.object.emplace(std::forward<Args>(args)...);
+            slot.pool = pool;
+            Park(index);
+        }
+
+        // Runs setup on a parked object of the pool before it joins the world, nullptr when the pool is exhausted
+        template<typename Setup>
+        Object* Revive(const PoolId& pool, Setup&& setup)
+        {
+            if(pool >= m_parked.size() || m_parked[pool].empty()) return nullptr;
+            auto index = m_parked[pool].back();
+            m_parked[pool].pop_back();
+            auto& slot = m_slots[index];
+            slot.parked = false;
+            slot.object->SetHandle(ObjectHandle{index, slot.generation});
+            setup(*slot.object);
+            Activate(index);
+            return &*slot.object;
+        }
+        std::size_t ParkedCount(const PoolId& pool) const;
+
+        // Hides the object from iteration and lookups right away, the storage is released on the next Flush.
+        void Destroy(const ObjectHandle& handle);
+        // Frame boundary: releases every object destroyed since the last call.
+        void Flush();
+        void Clear();
+        // Movement pass over the columns, run once per tick after logic has set the velocities.
+        void Move();
+        const EntityColumns& GetColumns() const;
+        const WorldQuery& GetWorld() const;
+
+        Object* Get(const ObjectHandle& handle);
+        ObjectHandle GetHandle(const uint32_t& index) const;
+        bool Contains(const ObjectHandle& handle) const;
+        std::size_t Size() const;
+        bool Empty() const;
+
+        Iterator begin();
+        Iterator end();
+
+    private:
+        struct Slot
+        {
+            std::optional<Object> object;
+            uint32_t generation = 0;
+            bool pendingDestroy = false;
+            PoolId pool = noPool;
+            bool parked = false;
+        };
+
+        std::deque<Slot> m_slots;
+        std::vector<uint32_t> m_freeSlots;
+        std::vector<uint32_t> m_live;
+        // Parked slots per pool, never grows past the number of objects the pool constructed
+        std::vector<std::vector<uint32_t>> m_parked;
+        EntityColumns m_columns;
+        WorldQuery m_world;
+        std::size_t m_size = 0;
+        std::size_t m_pendingCount = 0;
+
+        uint32_t AcquireSlot();
+        void Activate(const uint32_t& index);
+        void Park(const uint32_t& index);
+        // Ends the life of a slot's object: pooled ones are recycled and parked, the rest destroyed
+        void Release(const uint32_t& index);
+    };
+}
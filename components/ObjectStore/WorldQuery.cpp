@@ -0,0 +1,52 @@
+#include "WorldQuery.h"
+
+namespace GameUtils
+{
+    std::size_t WorldQuery::Count(const ObjectType& type) const
+    {
+        return m_counts[static_cast<std::size_t>(type)];
+    }
+
+    ObjectHandle WorldQuery::Find(const ObjectType& type) const
+    {
+        return m_tracked[static_cast<std::size_t>(type)];
+    }
+
+    ObjectHandle WorldQuery::GetPlayer() const
+    {
+        return Find(ObjectType::PLAYER);
+    }
+
+    ObjectHandle WorldQuery::GetBoss() const
+    {
+        return Find(ObjectType::BOSS);
+    }
+
+    void WorldQuery::OnCreate(const ObjectType& type, const ObjectHandle& handle)
+    {
+        auto index = static_cast<std::size_t>(type);
+        ++m_counts[index];
+        if(trackedTypes & TypeMask(type))
+            m_tracked[index] = handle;
+    }
+
+    bool WorldQuery::OnDestroy(const ObjectType& type, const ObjectHandle& handle)
+    {
+        auto index = static_cast<std::size_t>(type);
+        if(m_counts[index] > 0) --m_counts[index];
+        if(m_tracked[index] != handle) return false;
+        m_tracked[index] = ObjectHandle{};
+        return m_counts[index] > 0;
+    }
+
+    void WorldQuery::SetTracked(const ObjectType& type, const ObjectHandle& handle)
+    {
+        m_tracked[static_cast<std::size_t>(type)] = handle;
+    }
+
+    void WorldQuery::Clear()
+    {
+        m_counts.fill(0);
+        m_tracked.fill(ObjectHandle{});
+    }
+}
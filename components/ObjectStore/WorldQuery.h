@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "ObjectHandle.h"
+#include "Object/Object.h"
+#include "Collision/CollisionLayers.h"
+
+namespace GameUtils
+{
+    // Live counts per ObjectType and the handle of the latest PLAYER and BOSS,
+    // kept up to date by ObjectStore on every create and destroy so logic never scans the store.
+    class WorldQuery
+    {
+    public:
+        static constexpr uint32_t trackedTypes = TypeMask(ObjectType::PLAYER, ObjectType::BOSS);
+
+        WorldQuery() = default;
+
+        std::size_t Count(const ObjectType& type) const;
+        // Latest live object of a tracked type, invalid when none is alive or the type is not tracked
+        ObjectHandle Find(const ObjectType& type) const;
+        ObjectHandle GetPlayer() const;
+        ObjectHandle GetBoss() const;
+
+        void OnCreate(const ObjectType& type, const ObjectHandle& handle);
+        // Returns true when the destroyed object was the tracked one while others of its type remain
+        bool OnDestroy(const ObjectType& type, const ObjectHandle& handle);
+        void SetTracked(const ObjectType& type, const ObjectHandle& handle);
+        void Clear();
+
+    private:
+        std::array<std::size_t, objectTypeCount> m_counts{};
+        std::array<ObjectHandle, objectTypeCount> m_tracked{};
+    };
+}
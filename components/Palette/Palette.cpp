@@ -0,0 +1,149 @@
+#include <cstring>
+
+#include "Palette.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define PALETTE_KERNEL_SSE2
+#endif
+
+namespace GameUtils
+{
+    namespace
+    {
+        // Palettes up to this size are remapped with vector compares, larger ones through the LUT
+        constexpr std::size_t maxVectorPaletteSize = 8;
+
+        // sf::Color::toInteger() is 0xRRGGBBAA, pixels in memory are R,G,B,A bytes
+        uint32_t ToPixel(const uint32_t& color)
+        {
+            uint8_t bytes[4] = {static_cast<uint8_t>(color >> 24), static_cast<uint8_t>(color >> 16), static_cast<uint8_t>(color >> 8), static_cast<uint8_t>(color)};
+            uint32_t pixel;
+            std::memcpy(&pixel, bytes, sizeof(pixel));
+            return pixel;
+        }
+    }
+
+    Palette::Palette(const std::string& name, const std::vector<std::pair<uint32_t, uint32_t>>& remap) :
+        m_name(name)
+    {
+        for(auto& [from, to] : remap)
+        {
+            auto key = ToPixel(from);
+            auto slot = Hash(key);
+            while(m_used[slot] && m_keys[slot] != key)
+                slot = (slot + 1) % lutSize;
+            if(m_used[slot]) continue;
+
+            m_used[slot] = true;
+            m_keys[slot] = key;
+            m_values[slot] = ToPixel(to);
+            m_pixelRemap.emplace_back(key, m_values[slot]);
+            if(m_pixelRemap.size() == lutSize / 2) break;
+        }
+    }
+
+    Palette Palette::Cycled(const std::string& name, const std::vector<uint32_t>& colors, const int& cycle)
+    {
+        std::vector<std::pair<uint32_t, uint32_t>> remap;
+        for(auto color : colors)
+            remap.emplace_back(color, ColorCycling(color, cycle));
+        return Palette(name + "/" + std::to_string(cycle), remap);
+    }
+
+    uint32_t Palette::ColorCycling(const uint32_t& color, const int& cycle)
+    {
+        union {
+            struct {
+                unsigned B : 8;
+                unsigned G : 8;
+                unsigned R : 8;
+            };
+            uint32_t hexColor;
+        } primaryColor;
+
+        primaryColor.hexColor = color;
+        std::array<uint8_t, 3> primaryArray = {static_cast<uint8_t>(primaryColor.R), static_cast<uint8_t>(primaryColor.G), static_cast<uint8_t>(primaryColor.B)};
+
+        for(auto index = 0; index <= cycle; ++index)
+        {
+            std::swap(primaryArray[1], primaryArray[0]);
+            std::swap(primaryArray[2], primaryArray[1]);
+        }
+        primaryColor.R = primaryArray[0];
+        primaryColor.G = primaryArray[1];
+        primaryColor.B = primaryArray[2];
+        return primaryColor.hexColor;
+    }
+
+    const std::string& Palette::GetName() const
+    {
+        return m_name;
+    }
+
+    std::size_t Palette::Size() const
+    {
+        return m_pixelRemap.size();
+    }
+
+    std::size_t Palette::Hash(const uint32_t& pixel)
+    {
+        return (pixel * 0x9E3779B1u) >> 24;
+    }
+
+    bool Palette::Lookup(const uint32_t& pixel, uint32_t& replacement) const
+    {
+        for(auto slot = Hash(pixel); m_used[slot]; slot = (slot + 1) % lutSize)
+        {
+            if(m_keys[slot] == pixel)
+            {
+                replacement = m_values[slot];
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const std::vector<std::pair<uint32_t, uint32_t>>& Palette::GetPixelRemap() const
+    {
+        return m_pixelRemap;
+    }
+
+    void RemapPixelsScalar(uint8_t* pixels, const std::size_t& pixelCount, const Palette& palette)
+    {
+        for(std::size_t index = 0; index < pixelCount; ++index)
+        {
+            uint32_t pixel;
+            uint32_t replacement;
+            std::memcpy(&pixel, pixels + index * 4, sizeof(pixel));
+            if(palette.Lookup(pixel, replacement))
+                std::memcpy(pixels + index * 4, &replacement, sizeof(replacement));
+        }
+    }
+
+    void RemapPixels(uint8_t* pixels, const std::size_t& pixelCount, const Palette& palette)
+    {
+        std::size_t index = 0;
+
+#if defined(PALETTE_KERNEL_SSE2)
+        const auto& remap = palette.GetPixelRemap();
+        if(remap.size() <= maxVectorPaletteSize)
+        {
+            // Every lane is compared against the source colors only, so a replacement is never remapped twice
+            for(; index + 4 <= pixelCount; index += 4)
+            {
+                auto source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + index * 4));
+                auto result = source;
+                for(auto& [from, to] : remap)
+                {
+                    auto mask = _mm_cmpeq_epi32(source, _mm_set1_epi32(static_cast<int>(from)));
+                    result = _mm_or_si128(_mm_andnot_si128(mask, result), _mm_and_si128(mask, _mm_set1_epi32(static_cast<int>(to))));
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + index * 4), result);
+            }
+        }
+#endif
+
+        RemapPixelsScalar(pixels + index * 4, pixelCount - index, palette);
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+namespace GameUtils
+{
+    // Color replacement table. Colors are given as sf::Color::toInteger() values (0xRRGGBBAA),
+    // lookups go through a 256 slot open addressing table keyed on the raw pixel.
+    class Palette
+    {
+    public:
+        Palette() = default;
+        Palette(const std::string& name, const std::vector<std::pair<uint32_t, uint32_t>>& remap);
+
+        // Every color is replaced by its ColorCycling rotation, the cycle is part of the cache key
+        static Palette Cycled(const std::string& name, const std::vector<uint32_t>& colors, const int& cycle);
+        static uint32_t ColorCycling(const uint32_t& color, const int& cycle);
+
+        const std::string& GetName() const;
+        std::size_t Size() const;
+        // Pixels are in memory order, as read from sf::Image::getPixelsPtr()
+        bool Lookup(const uint32_t& pixel, uint32_t& replacement) const;
+        const std::vector<std::pair<uint32_t, uint32_t>>& GetPixelRemap() const;
+
+    private:
+        static constexpr std::size_t lutSize = 256;
+
+        std::string m_name;
+        std::vector<std::pair<uint32_t, uint32_t>> m_pixelRemap;
+        std::array<uint32_t, lutSize> m_keys{};
+        std::array<uint32_t, lutSize> m_values{};
+        std::array<bool, lutSize> m_used{};
+
+        static std::size_t Hash(const uint32_t& pixel);
+    };
+
+    // Rewrites pixelCount RGBA pixels in place. Small palettes run a SIMD compare/blend, larger ones the LUT.
+    void RemapPixels(uint8_t* pixels, const std::size_t& pixelCount, const Palette& palette);
+    void RemapPixelsScalar(uint8_t* pixels, const std::size_t& pixelCount, const Palette& palette);
+}
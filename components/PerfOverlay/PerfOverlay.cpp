@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+#include "PerfOverlay.h"
+#include "Object/Object.h"
+
+namespace GameEngine
+{
+    namespace
+    {
+        constexpr float panelWidth = 260.0f;
+        constexpr float panelMargin = 8.0f;
+        constexpr float graphHeight = 48.0f;
+        //Bars reach the top of the graph at two 60 Hz frames
+        constexpr float graphScaleMs = 33.3f;
+        constexpr float targetFrameMs = 16.7f;
+    }
+
+    bool PerfOverlay::Bake(const sf::Font& font, const unsigned int& characterSize)
+    {
+        //Every glyph is rasterized into the font page first, the page is then copied so later text never touches it
+        for(auto character = firstGlyph; character <= lastGlyph; ++character)
+            font.getGlyph(static_cast<sf::Uint32>(character), characterSize, false);
+
+        m_glyphTexture = font.getTexture(characterSize);
+        if(m_glyphTexture.getSize().x == 0) return false;
+        m_glyphTexture.setSmooth(false);
+
+        for(auto character = firstGlyph; character <= lastGlyph; ++character)
+        {
+            const auto& glyph = font.getGlyph(static_cast<sf::Uint32>(character), characterSize, false);
+            m_glyphs[character - firstGlyph] = {glyph.textureRect, {glyph.bounds.left, glyph.bounds.top + characterSize}, glyph.advance};
+        }
+        //Font pages reserve a white square at their origin for underlines, reused for the panel and the graph
+        m_solidRect = {0, 0, 1, 1};
+        m_lineHeight = font.getLineSpacing(characterSize);
+        m_baked = true;
+        return true;
+    }
+
+    void PerfOverlay::Toggle()
+    {
+        m_visible = !m_visible;
+    }
+
+    bool PerfOverlay::IsVisible() const
+    {
+        return m_visible && m_baked;
+    }
+
+    void PerfOverlay::Sample(const PerfOverlaySample& sample)
+    {
+        m_last = sample;
+        m_frameHistory[m_historyHead] = static_cast<float>(sample.frameMs);
+        m_historyHead = (m_historyHead + 1) % historySize;
+        m_historyCount = std::min(m_historyCount + 1, historySize);
+    }
+
+    void PerfOverlay::AppendTo(std::vector<SpriteSnapshot>& sprites, const sf::Vector2f& viewportSize) const
+    {
+        if(!IsVisible()) return;
+
+        auto origin = sf::Vector2f{viewportSize.x - panelWidth - panelMargin, panelMargin};
+        //Eleven counter lines plus one per object type, UNKNOWN excluded
+        auto lines = 11 + GameUtils::objectTypeCount - 1;
+        AppendRect(sprites, {origin.x, origin.y, panelWidth, graphHeight + panelMargin * 3 + lines * m_lineHeight}, sf::Color(0, 0, 0, 170));
+
+        //Frame time graph, oldest sample on the left
+        auto barWidth = (panelWidth - panelMargin * 2) / historySize;
+        auto graphBottom = origin.y + panelMargin + graphHeight;
+        for(std::size_t sample = 0; sample < m_historyCount; ++sample)
+        {
+            auto frameMs = m_frameHistory[(m_historyHead + historySize - m_historyCount + sample) % historySize];
+            auto height = std::min(frameMs / graphScaleMs, 1.0f) * graphHeight;
+            auto color = frameMs <= targetFrameMs + 1.0f ? sf::Color::Green : (frameMs <= graphScaleMs ? sf::Color::Yellow : sf::Color::Red);
+            AppendRect(sprites, {origin.x + panelMargin + sample * barWidth, graphBottom - height, std::max(barWidth - 1.0f, 1.0f), height}, color);
+        }
+        AppendRect(sprites, {origin.x + panelMargin, graphBottom - targetFrameMs / graphScaleMs * graphHeight, panelWidth - panelMargin * 2, 1.0f}, sf::Color(255, 255, 255, 120));
+
+        char line[64];
+        auto pen = sf::Vector2f{origin.x + panelMargin, graphBottom + panelMargin};
+        auto print = [&](const sf::Color& color)
+        {
+            AppendText(sprites, line, pen, color);
+            pen.y += m_lineHeight;
+        };
+
+        std::snprintf(line, sizeof(line), "frame %.2f ms", m_last.frameMs);
+        print(sf::Color::White);
+        std::snprintf(line, sizeof(line), "sim %.2f ms  render %.2f ms", m_last.simulationTickMs, m_last.renderMs);
+        print(sf::Color::White);
+        std::snprintf(line, sizeof(line), "snapshot latency %.2f ms", m_last.snapshotLatencyMs);
+        print(sf::Color::White);
+        std::snprintf(line, sizeof(line), "jitter %.2f ms  cpu %.0f%%", m_last.pacer.jitterMs, m_last.pacer.cpuUtilization * 100.0);
+        print(sf::Color::White);
+        std::snprintf(line, sizeof(line), "draws %zu  binds %zu", m_last.render.drawCalls, m_last.render.textureBinds);
+        print(sf::Color::White);
+        std::snprintf(line, sizeof(line), "sprites %zu  batches %zu", m_last.render.sprites, m_last.render.batches);
+        print(sf::Color::White);
+        std::snprintf(line, sizeof(line), "allocs/tick %llu  %llu B", static_cast<unsigned long long>(m_last.tickAllocations.allocations),
+                      static_cast<unsigned long long>(m_last.tickAllocations.bytes));
+        print(m_last.tickAllocations.allocations == 0 ? sf::Color::White : sf::Color::Yellow);
+        std::snprintf(line, sizeof(line), "arena %zu B  peak %zu B  fallbacks %llu", m_last.frameArena.lastTickBytes, m_last.frameArena.highWaterBytes,
+                      static_cast<unsigned long long>(m_last.frameArena.fallbacks));
+        print(m_last.frameArena.fallbacks == 0 ? sf::Color::White : sf::Color::Yellow);
+        std::snprintf(line, sizeof(line), "textures hit %zu  miss %zu", m_last.textureHits, m_last.textureMisses);
+        print(sf::Color::White);
+        std::snprintf(line, sizeof(line), "background loads %zu", m_last.backgroundLoads);
+        print(sf::Color::White);
+        std::snprintf(line, sizeof(line), "voices %zu/%zu  steals %.1f/s", m_last.audio.voicesInUse, m_last.audio.voiceCount, m_last.audio.stealsPerSecond);
+        print(sf::Color::White);
+        static const auto typeNames = []()
+        {
+            std::array<std::string, GameUtils::objectTypeCount> names;
+            for(auto type = 0; type < GameUtils::objectTypeCount; ++type)
+                names[type] = GameUtils::ObjectTypeToString(static_cast<GameUtils::ObjectType>(type));
+            return names;
+        }();
+        for(auto type = 1; type < GameUtils::objectTypeCount; ++type)
+        {
+            std::snprintf(line, sizeof(line), "%-17s %zu", typeNames[type].c_str(), m_last.objectCounts[type]);
+            print(sf::Color(200, 200, 200));
+        }
+    }
+
+    void PerfOverlay::AppendText(std::vector<SpriteSnapshot>& sprites, const char* text, const sf::Vector2f& position, const sf::Color& color) const
+    {
+        auto penX = position.x;
+        for(auto character = text; *character != '\0'; ++character)
+        {
+            if(*character < firstGlyph || *character > lastGlyph) continue;
+            const auto& glyph = m_glyphs[*character - firstGlyph];
+            if(glyph.textureRect.width > 0 && glyph.textureRect.height > 0)
+            {
+                sf::Transform transform;
+                transform.translate(penX + glyph.offset.x, position.y + glyph.offset.y);
+                sprites.push_back({&m_glyphTexture, glyph.textureRect, transform, color, {0.0f, 0.0f}, overlayLayer});
+            }
+            penX += glyph.advance;
+        }
+    }
+
+    void PerfOverlay::AppendRect(std::vector<SpriteSnapshot>& sprites, const sf::FloatRect& rect, const sf::Color& color) const
+    {
+        sf::Transform transform;
+        transform.translate(rect.left, rect.top).scale(rect.width / m_solidRect.width, rect.height / m_solidRect.height);
+        sprites.push_back({&m_glyphTexture, m_solidRect, transform, color, {0.0f, 0.0f}, overlayLayer});
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <cstddef>
+
+#include "SFML/Graphics.hpp"
+
+#include "RenderThread/RenderSnapshot.h"
+#include "SpriteBatch/SpriteBatch.h"
+#include "Collision/CollisionLayers.h"
+#include "AllocationTracker/AllocationTracker.h"
+#include "FrameArena/FrameArena.h"
+#include "Sound/VoicePool.h"
+#include "FramePacer/FramePacer.h"
+
+namespace GameEngine
+{
+    // Above every game layer so the overlay is never covered
+    constexpr int overlayLayer = 1000;
+
+    // Numbers shown by the overlay, gathered by GameThread once per published snapshot
+    struct PerfOverlaySample
+    {
+        double frameMs = 0.0;
+        double simulationTickMs = 0.0;
+        double renderMs = 0.0;
+        double snapshotLatencyMs = 0.0;
+        FramePacerStats pacer;
+        SpriteBatchStats render;
+        GameUtils::AllocationCounters tickAllocations;
+        GameUtils::FrameArenaStats frameArena;
+        std::size_t textureHits = 0;
+        std::size_t textureMisses = 0;
+        std::size_t backgroundLoads = 0;
+        GameUtils::VoicePoolStats audio;
+        std::array<std::size_t, GameUtils::objectTypeCount> objectCounts{};
+    };
+
+    // Frame time graph and counters drawn as quads from a glyph page baked once at startup,
+    // the whole overlay is a single batch on one texture and building it does not allocate once warmed up.
+    class PerfOverlay
+    {
+    public:
+        static constexpr std::size_t historySize = 120;
+
+        // Bakes printable ASCII at characterSize, the overlay cannot be shown without it
+        bool Bake(const sf::Font& font, const unsigned int& characterSize);
+        void Toggle();
+        bool IsVisible() const;
+
+        void Sample(const PerfOverlaySample& sample);
+        // Appends the panel anchored to the top right corner of the viewport
+        void AppendTo(std::vector<SpriteSnapshot>& sprites, const sf::Vector2f& viewportSize) const;
+
+    private:
+        static constexpr char firstGlyph = ' ';
+        static constexpr char lastGlyph = '~';
+
+        struct BakedGlyph
+        {
+            sf::IntRect textureRect;
+            sf::Vector2f offset;
+            float advance = 0.0f;
+        };
+
+        sf::Texture m_glyphTexture;
+        std::array<BakedGlyph, lastGlyph - firstGlyph + 1> m_glyphs;
+        sf::IntRect m_solidRect;
+        float m_lineHeight = 0.0f;
+        bool m_baked = false;
+        bool m_visible = false;
+
+        std::array<float, historySize> m_frameHistory{};
+        std::size_t m_historyHead = 0;
+        std::size_t m_historyCount = 0;
+        PerfOverlaySample m_last;
+
+        void AppendText(std::vector<SpriteSnapshot>& sprites, const char* text, const sf::Vector2f& position, const sf::Color& color) const;
+        void AppendRect(std::vector<SpriteSnapshot>& sprites, const sf::FloatRect& rect, const sf::Color& color) const;
+    };
+}
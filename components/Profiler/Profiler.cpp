@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+#include "Profiler.h"
+
+namespace GameUtils
+{
+    Profiler& Profiler::Instance()
+    {
+        static Profiler instance;
+        return instance;
+    }
+
+    Profiler::Profiler() : m_epoch(std::chrono::steady_clock::now())
+    {
+    }
+
+    void Profiler::SetEnabled(const bool& enabled)
+    {
+        s_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    ZoneId Profiler::RegisterZone(const std::string& name)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto found = std::find(m_zoneNames.begin(), m_zoneNames.end(), name);
+        if(found != m_zoneNames.end())
+            return static_cast<ZoneId>(found - m_zoneNames.begin());
+        m_zoneNames.push_back(name);
+        return static_cast<ZoneId>(m_zoneNames.size() - 1);
+    }
+
+    std::string Profiler::GetZoneName(const ZoneId& zone) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return zone < m_zoneNames.size() ? m_zoneNames[zone] : std::string();
+    }
+
+    void Profiler::SetThreadName(const std::string& name)
+    {
+        auto& ring = LocalRing();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ring.name = name;
+    }
+
+    void Profiler::Record(const ZoneId& zone, const uint64_t& startNs, const uint64_t& endNs)
+    {
+        auto& ring = LocalRing();
+        auto head = ring.head.load(std::memory_order_relaxed);
+        ring.events[head % ringCapacity] = {zone, startNs, endNs};
+        ring.head.store(head + 1, std::memory_order_release);
+    }
+
+    uint64_t Profiler::Now() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_epoch).count();
+    }
+
+    Profiler::ThreadRing& Profiler::LocalRing()
+    {
+        //Only the first zone of each thread takes the lock
+        thread_local ThreadRing* localRing = nullptr;
+        if(localRing == nullptr)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_rings.push_back(std::make_unique<ThreadRing>());
+            localRing = m_rings.back().get();
+            localRing->threadId = static_cast<uint32_t>(m_rings.size());
+            localRing->name = "thread " + std::to_string(localRing->threadId);
+        }
+        return *localRing;
+    }
+
+    void Profiler::CopyEvents(const ThreadRing& ring, std::vector<ZoneEvent>& events)
+    {
+        //The owner keeps writing meanwhile, entries it may have lapped during the copy are dropped
+        auto head = ring.head.load(std::memory_order_acquire);
+        auto first = head > ringCapacity ? head - ringCapacity : 0;
+        auto copyStart = events.size();
+        for(auto index = first; index < head; ++index)
+            events.push_back(ring.events[index % ringCapacity]);
+
+        auto headAfter = ring.head.load(std::memory_order_acquire);
+        auto firstValid = headAfter > ringCapacity ? headAfter - ringCapacity : 0;
+        if(firstValid > first)
+        {
+            auto lapped = std::min<uint64_t>(firstValid - first, head - first);
+            events.erase(events.begin() + copyStart, events.begin() + copyStart + lapped);
+        }
+    }
+
+    std::vector<ZoneSummary> Profiler::Summarize() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<std::vector<uint64_t>> durations(m_zoneNames.size());
+        std::vector<ZoneEvent> events;
+        for(const auto& ring : m_rings)
+            CopyEvents(*ring, events);
+        for(const auto& event : events)
+            if(event.zone < durations.size())
+                durations[event.zone].push_back(event.end - event.start);
+
+        std::vector<ZoneSummary> summaries;
+        for(std::size_t zone = 0; zone < durations.size(); ++zone)
+        {
+            auto& samples = durations[zone];
+            if(samples.empty()) continue;
+            std::sort(samples.begin(), samples.end());
+
+            ZoneSummary summary;
+            summary.name = m_zoneNames[zone];
+            summary.count = samples.size();
+            summary.p50Ms = samples[(samples.size() - 1) / 2] / 1e6;
+            summary.p99Ms = samples[(samples.size() - 1) * 99 / 100] / 1e6;
+            for(auto sample : samples)
+                summary.totalMs += sample / 1e6;
+            summaries.push_back(summary);
+        }
+        return summaries;
+    }
+
+    bool Profiler::ExportChromeTrace(const std::string& path) const
+    {
+        std::ofstream file(path);
+        if(!file.is_open()) return false;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        file << std::fixed << std::setprecision(3);
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        auto separator = "";
+        std::vector<ZoneEvent> events;
+        for(const auto& ring : m_rings)
+        {
+            file << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << ring->threadId
+                 << ",\"args\":{\"name\":\"" << ring->name << "\"}}";
+            separator = ",\n";
+
+            events.clear();
+            CopyEvents(*ring, events);
+            for(const auto& event : events)
+            {
+                if(event.zone >= m_zoneNames.size()) continue;
+                file << separator << "{\"name\":\"" << m_zoneNames[event.zone] << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << ring->threadId
+                     << ",\"ts\":" << event.start / 1000.0 << ",\"dur\":" << (event.end - event.start) / 1000.0 << "}";
+            }
+        }
+        file << "]}\n";
+        return file.good();
+    }
+}
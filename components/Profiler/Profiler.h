@@ -0,0 +1,133 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace GameUtils
+{
+    using ZoneId = uint16_t;
+    constexpr ZoneId noZone = std::numeric_limits<ZoneId>::max();
+
+    struct ZoneSummary
+    {
+        std::string name;
+        std::size_t count = 0;
+        double p50Ms = 0.0;
+        double p99Ms = 0.0;
+        double totalMs = 0.0;
+    };
+
+    // Scoped-zone profiler. Every thread appends finished zones to its own ring without locking,
+    // summaries and exports copy the rings out, so they only ever see the most recent ringCapacity zones per thread.
+    class Profiler
+    {
+    public:
+        static constexpr std::size_t ringCapacity = 1 << 14;
+
+        static Profiler& Instance();
+
+        Profiler(const Profiler&) = delete;
+        Profiler& operator=(const Profiler&) = delete;
+
+        static bool IsEnabled()
+        {
+            return s_enabled.load(std::memory_order_relaxed);
+        }
+        void SetEnabled(const bool& enabled);
+
+        // Innermost zone open on the calling thread, noZone outside of any zone or while disabled
+        static ZoneId CurrentZone()
+        {
+            return s_currentZone;
+        }
+        static void SetCurrentZone(const ZoneId& zone)
+        {
+            s_currentZone = zone;
+        }
+
+        // Meant to be called once per call site and kept in a function local static
+        ZoneId RegisterZone(const std::string& name);
+        // Label of the calling thread in exported traces
+        void SetThreadName(const std::string& name);
+        void Record(const ZoneId& zone, const uint64_t& startNs, const uint64_t& endNs);
+        // Nanoseconds since the profiler was created
+        uint64_t Now() const;
+
+        // Percentiles per zone over the zones still held in the rings, zones never recorded are skipped
+        std::vector<ZoneSummary> Summarize() const;
+        // Chrome trace event format, loads in chrome://tracing and Perfetto
+        bool ExportChromeTrace(const std::string& path) const;
+        std::string GetZoneName(const ZoneId& zone) const;
+
+    private:
+        Profiler();
+
+        struct ZoneEvent
+        {
+            ZoneId zone = 0;
+            uint64_t start = 0;
+            uint64_t end = 0;
+        };
+
+        struct ThreadRing
+        {
+            std::string name;
+            uint32_t threadId = 0;
+            std::array<ZoneEvent, ringCapacity> events;
+            std::atomic<uint64_t> head = 0;
+        };
+
+        static inline std::atomic<bool> s_enabled = false;
+        static inline thread_local ZoneId s_currentZone = noZone;
+
+        mutable std::mutex m_mutex;
+        std::vector<std::string> m_zoneNames;
+        std::vector<std::unique_ptr<ThreadRing>> m_rings;
+        std::chrono::steady_clock::time_point m_epoch;
+
+        ThreadRing& LocalRing();
+        static void CopyEvents(const ThreadRing& ring, std::vector<ZoneEvent>& events);
+    };
+
+    // Times its own lifetime into a zone. When the profiler is disabled both ends cost one predictable branch.
+    class ProfileScope
+    {
+    public:
+        explicit ProfileScope(const ZoneId& zone)
+        {
+            if(Profiler::IsEnabled())
+            {
+                m_zone = zone;
+                m_parent = Profiler::CurrentZone();
+                Profiler::SetCurrentZone(zone);
+                m_start = Profiler::Instance().Now();
+                m_active = true;
+            }
+        }
+
+        ~ProfileScope()
+        {
+            if(m_active)
+            {
+                Profiler::Instance().Record(m_zone, m_start, Profiler::Instance().Now());
+                Profiler::SetCurrentZone(m_parent);
+            }
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        ZoneId m_zone = 0;
+        ZoneId m_parent = noZone;
+        uint64_t m_start = 0;
+        bool m_active = false;
+    };
+}
@@ -0,0 +1,56 @@
+#include <algorithm>
+
+#include "ProjectilePool.h"
+
+namespace GameEngine
+{
+    ProjectilePool::ProjectilePool(GameUtils::ObjectStore& store) : m_store(store)
+    {
+    }
+
+    void ProjectilePool::Register(const ProjectileKind& kind, const ProjectileKindDesc& desc)
+    {
+        auto& pool = m_pools[static_cast<std::size_t>(kind)];
+        pool.desc = desc;
+        for(std::size_t object = 0; object < desc.capacity; ++object)
+            Grow(kind);
+    }
+
+    ProjectilePoolStats ProjectilePool::GetStats(const ProjectileKind& kind) const
+    {
+        auto stats = m_pools[static_cast<std::size_t>(kind)].stats;
+        stats.live = stats.capacity - m_store.ParkedCount(PoolOf(kind));
+        return stats;
+    }
+
+    std::string ProjectilePool::KindToString(const ProjectileKind& kind)
+    {
+        switch(kind)
+        {
+            case ProjectileKind::PLAYER_SHOT: return "Player Shot";
+            case ProjectileKind::ENEMY_SHOT: return "Enemy Shot";
+            case ProjectileKind::BOSS_SPREAD_SHOT: return "Boss Spread Shot";
+            case ProjectileKind::BOSS_SHOT: return "Boss Shot";
+            default: return "";
+        }
+    }
+
+    GameUtils::PoolId ProjectilePool::PoolOf(const ProjectileKind& kind)
+    {
+        return static_cast<GameUtils::PoolId>(kind);
+    }
+
+    void ProjectilePool::Grow(const ProjectileKind& kind)
+    {
+        auto& pool = m_pools[static_cast<std::size_t>(kind)];
+        const auto& desc = pool.desc;
+        m_store.CreateParked(PoolOf(kind), desc.id, desc.type, desc.texturePath, desc.soundPath, desc.prepare, desc.logic, desc.animationFrametime, desc.hitPoints);
+        ++pool.stats.capacity;
+    }
+
+    void ProjectilePool::UpdateLive(const ProjectileKind& kind)
+    {
+        auto& stats = m_pools[static_cast<std::size_t>(kind)].stats;
+        stats.peakLive = std::max(stats.peakLive, stats.capacity - m_store.ParkedCount(PoolOf(kind)));
+    }
+}
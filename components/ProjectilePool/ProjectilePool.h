@@ -0,0 +1,108 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "Object/Object.h"
+#include "ObjectStore/ObjectStore.h"
+
+namespace GameEngine
+{
+    // Every kind has its own texture, sound and logic, the boss fires two of them with the same ObjectType
+    enum class ProjectileKind : uint8_t
+    {
+        PLAYER_SHOT = 0,
+        ENEMY_SHOT,
+        BOSS_SPREAD_SHOT,
+        BOSS_SHOT,
+        COUNT
+    };
+
+    enum class PoolOverflow
+    {
+        // The spawn is skipped, no allocation ever happens after warm up
+        DROP,
+        // One more object is constructed, it stays in the pool afterwards
+        GROW
+    };
+
+    // Everything an object of the kind is constructed with, prepare runs once per constructed object
+    struct ProjectileKindDesc
+    {
+        GameUtils::ObjectType type = GameUtils::ObjectType::PROJECTILE;
+        std::string id;
+        std::string texturePath;
+        std::string soundPath;
+        std::function<void(GameUtils::Object&)> prepare = [](GameUtils::Object&){};
+        std::function<void(GameUtils::Object&)> logic = [](GameUtils::Object&){};
+        std::chrono::milliseconds animationFrametime = 150ms;
+        int hitPoints = 1;
+        // Sized for the largest burst on screen, a spawn past it is dropped unless the kind opts into GROW
+        std::size_t capacity = 256;
+        PoolOverflow overflow = PoolOverflow::DROP;
+    };
+
+    struct ProjectilePoolStats
+    {
+        std::size_t capacity = 0;
+        std::size_t live = 0;
+        std::size_t peakLive = 0;
+        uint64_t spawns = 0;
+        // Spawns that found the pool empty, dropped or grown depending on the policy
+        uint64_t overflows = 0;
+    };
+
+    // Pre-sized pools of projectile objects living in the ObjectStore. Spawning revives a parked object and runs
+    // the setup on it in place, destroying it parks it again on the next Flush, both in O(1).
+    class ProjectilePool
+    {
+    public:
+        explicit ProjectilePool(GameUtils::ObjectStore& store);
+
+        ProjectilePool(const ProjectilePool&) = delete;
+        ProjectilePool& operator=(const ProjectilePool&) = delete;
+
+        // Constructs desc.capacity parked objects, textures and sounds are loaded here and never on spawn
+        void Register(const ProjectileKind& kind, const ProjectileKindDesc& desc);
+
+        // setup places the projectile, it is taken as a template so capturing lambdas are never boxed into a std::function.
+        // Returns nullptr when the pool is empty and drops on overflow.
+        template<typename Setup>
+        GameUtils::Object* Spawn(const ProjectileKind& kind, Setup&& setup)
+        {
+            auto& pool = m_pools[static_cast<std::size_t>(kind)];
+            ++pool.stats.spawns;
+            auto object = m_store.Revive(PoolOf(kind), setup);
+            if(object == nullptr)
+            {
+                ++pool.stats.overflows;
+                if(pool.desc.overflow == PoolOverflow::DROP) return nullptr;
+                Grow(kind);
+                object = m_store.Revive(PoolOf(kind), setup);
+            }
+            UpdateLive(kind);
+            return object;
+        }
+
+        ProjectilePoolStats GetStats(const ProjectileKind& kind) const;
+        static std::string KindToString(const ProjectileKind& kind);
+
+    private:
+        struct Pool
+        {
+            ProjectileKindDesc desc;
+            ProjectilePoolStats stats;
+        };
+
+        GameUtils::ObjectStore& m_store;
+        std::array<Pool, static_cast<std::size_t>(ProjectileKind::COUNT)> m_pools;
+
+        static GameUtils::PoolId PoolOf(const ProjectileKind& kind);
+        void Grow(const ProjectileKind& kind);
+        void UpdateLive(const ProjectileKind& kind);
+    };
+}
@@ -0,0 +1,116 @@
+#include <random>
+#include <utility>
+
+#include "Random.h"
+
+namespace GameUtils
+{
+    namespace
+    {
+        uint64_t SplitMix64(uint64_t value)
+        {
+            value += 0x9E3779B97F4A7C15ULL;
+            value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+            return value ^ (value >> 31);
+        }
+    }
+
+    Pcg32::Pcg32(const uint64_t& seed, const uint64_t& stream)
+        : m_state(0), m_increment((stream << 1) | 1)
+    {
+        (*this)();
+        m_state += seed;
+        (*this)();
+    }
+
+    Pcg32::result_type Pcg32::operator()()
+    {
+        auto oldState = m_state;
+        m_state = oldState * 6364136223846793005ULL + m_increment;
+        auto xorShifted = static_cast<uint32_t>(((oldState >> 18) ^ oldState) >> 27);
+        auto rotation = static_cast<uint32_t>(oldState >> 59);
+        return (xorShifted >> rotation) | (xorShifted << ((32 - rotation) & 31));
+    }
+
+    uint32_t Pcg32::Below(const uint32_t& bound)
+    {
+        //Lemire's multiply-shift, the rare low products inside the biased zone are redrawn
+        auto product = static_cast<uint64_t>((*this)()) * bound;
+        auto low = static_cast<uint32_t>(product);
+        if(low < bound)
+        {
+            auto threshold = (0u - bound) % bound;
+            while(low < threshold)
+            {
+                product = static_cast<uint64_t>((*this)()) * bound;
+                low = static_cast<uint32_t>(product);
+            }
+        }
+        return static_cast<uint32_t>(product >> 32);
+    }
+
+    int Pcg32::Range(const int& low, const int& high)
+    {
+        return low + static_cast<int>(Below(static_cast<uint32_t>(high - low) + 1));
+    }
+
+    Random& Random::Instance()
+    {
+        static Random instance;
+        return instance;
+    }
+
+    Random::Random()
+    {
+        Seed(0);
+    }
+
+    void Random::Seed(const uint64_t& seed)
+    {
+        m_seed = seed;
+        for(std::size_t stream = 0; stream < m_streams.size(); ++stream)
+            m_streams[stream] = Pcg32(SplitMix64(seed), stream);
+    }
+
+    uint64_t Random::GetSeed() const
+    {
+        return m_seed;
+    }
+
+    Pcg32& Random::Stream(const RandomStream& stream)
+    {
+        return m_streams[static_cast<std::size_t>(stream)];
+    }
+
+    uint64_t Random::EntropySeed()
+    {
+        std::random_device device;
+        return (static_cast<uint64_t>(device()) << 32) | device();
+    }
+
+    void ShuffleBag::Reset(const int& size)
+    {
+        m_indices.resize(size);
+        for(auto index = 0; index < size; ++index)
+            m_indices[index] = index;
+        m_remaining = m_indices.size();
+    }
+
+    int ShuffleBag::Draw(Pcg32& rng)
+    {
+        if(m_indices.empty()) return -1;
+        if(m_remaining == 0) m_remaining = m_indices.size();
+
+        //Incremental Fisher-Yates, the drawn index is parked past the remaining range
+        auto pick = rng.Below(static_cast<uint32_t>(m_remaining));
+        --m_remaining;
+        std::swap(m_indices[pick], m_indices[m_remaining]);
+        return m_indices[m_remaining];
+    }
+
+    int ShuffleBag::Size() const
+    {
+        return static_cast<int>(m_indices.size());
+    }
+}
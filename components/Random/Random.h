@@ -0,0 +1,78 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+
+namespace GameUtils
+{
+    // Independent sequences drawn from the same seed, a subsystem drawing more or less never shifts another one
+    enum class RandomStream : int
+    {
+        ENEMY_FIRE = 0,
+        COUNT
+    };
+
+    // PCG32 (XSH-RR): 64 bit state, the stream selects one of 2^63 distinct sequences.
+    // Satisfies UniformRandomBitGenerator so it also feeds std algorithms.
+    class Pcg32
+    {
+    public:
+        using result_type = uint32_t;
+
+        Pcg32() = default;
+        Pcg32(const uint64_t& seed, const uint64_t& stream);
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+        result_type operator()();
+
+        // Unbiased value in [0, bound), bound must be positive
+        uint32_t Below(const uint32_t& bound);
+        // Unbiased value in [low, high]
+        int Range(const int& low, const int& high);
+
+    private:
+        uint64_t m_state = 0x853C49E6748FEA9BULL;
+        uint64_t m_increment = 0xDA3E39CB94B95BDBULL;
+    };
+
+    // Game-wide generator: a single seed drives one Pcg32 per RandomStream
+    class Random
+    {
+    public:
+        static Random& Instance();
+
+        Random(const Random&) = delete;
+        Random& operator=(const Random&) = delete;
+
+        // Restarts every stream, the same seed and inputs replay the same run
+        void Seed(const uint64_t& seed);
+        uint64_t GetSeed() const;
+        Pcg32& Stream(const RandomStream& stream);
+
+        // Seed taken from std::random_device, only meant for the initial seed of a session
+        static uint64_t EntropySeed();
+
+    private:
+        Random();
+
+        uint64_t m_seed = 0;
+        std::array<Pcg32, static_cast<std::size_t>(RandomStream::COUNT)> m_streams;
+    };
+
+    // Draws indices in [0, size) without repeating one until all were drawn, then starts over
+    class ShuffleBag
+    {
+    public:
+        void Reset(const int& size);
+        int Draw(Pcg32& rng);
+        int Size() const;
+
+    private:
+        std::vector<int> m_indices;
+        std::size_t m_remaining = 0;
+    };
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <chrono>
+#include <vector>
+
+#include "SFML/Graphics.hpp"
+
+#include "GameUtils/GameUtils.h"
+
+namespace GameEngine
+{
+    // A sprite as it stood at the end of a tick. The texture is owned by TextureCache and outlives every snapshot.
+    struct SpriteSnapshot
+    {
+        const sf::Texture* texture = nullptr;
+        sf::IntRect textureRect;
+        sf::Transform transform;
+        sf::Color color = sf::Color::White;
+        // Displacement over the last tick, zero when the sprite must not be interpolated
+        sf::Vector2f velocity;
+        int layer = 0;
+    };
+
+    // Everything the render thread draws for one simulated tick, copied out so it is never shared with the simulation
+    struct RenderSnapshot
+    {
+        GameUtils::Tick tick = 0;
+        std::chrono::steady_clock::time_point publishedAt;
+        bool interpolate = false;
+        // Menu, pause and game over screens are presented at the idle interval
+        bool idle = false;
+        std::vector<SpriteSnapshot> sprites;
+        std::vector<sf::Text> texts;
+
+        // Keeps vector capacity, steady ticks do not allocate. Texts are resized and assigned
+        // in place by the publisher so their string and vertex buffers are reused as well.
+        void Clear()
+        {
+            sprites.clear();
+            interpolate = false;
+            idle = false;
+        }
+    };
+}
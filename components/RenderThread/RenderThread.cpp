@@ -0,0 +1,140 @@
+#include <algorithm>
+
+#include "RenderThread.h"
+#include "Profiler/Profiler.h"
+
+namespace GameEngine
+{
+    namespace
+    {
+        //Weight of the newest sample in the smoothed timings
+        constexpr double smoothing = 1.0 / 16.0;
+
+        double Smooth(const double& average, const std::chrono::nanoseconds& sample)
+        {
+            auto sampleMs = std::chrono::duration<double, std::milli>(sample).count();
+            return average == 0.0 ? sampleMs : average + (sampleMs - average) * smoothing;
+        }
+    }
+
+    RenderThread::~RenderThread()
+    {
+        Stop();
+    }
+
+    FramePacer& RenderThread::GetFramePacer()
+    {
+        return m_framePacer;
+    }
+
+    void RenderThread::Start(const std::shared_ptr<sf::RenderWindow>& window)
+    {
+        if(m_running) return;
+        m_window = window;
+        //The context can only be current on one thread, it is handed over for the lifetime of the render thread
+        m_window->setActive(false);
+        m_running = true;
+        m_thread = std::thread(&RenderThread::Run, this);
+    }
+
+    void RenderThread::Stop()
+    {
+        if(!m_running) return;
+        m_running = false;
+        if(m_thread.joinable())
+            m_thread.join();
+        m_window->setActive(true);
+    }
+
+    bool RenderThread::IsRunning() const
+    {
+        return m_running;
+    }
+
+    RenderSnapshot& RenderThread::BeginSnapshot()
+    {
+        auto& snapshot = m_snapshots.GetWriteBuffer();
+        snapshot.Clear();
+        return snapshot;
+    }
+
+    void RenderThread::Publish()
+    {
+        m_snapshots.GetWriteBuffer().publishedAt = std::chrono::steady_clock::now();
+        m_snapshots.Publish();
+    }
+
+    RenderThreadStats RenderThread::GetStats() const
+    {
+        std::lock_guard<std::mutex> lock(m_statsMutex);
+        return m_stats;
+    }
+
+    void RenderThread::Run()
+    {
+        static const auto drawZone = GameUtils::Profiler::Instance().RegisterZone("DrawSnapshot");
+        static const auto displayZone = GameUtils::Profiler::Instance().RegisterZone("Display");
+        static const auto waitZone = GameUtils::Profiler::Instance().RegisterZone("FramePacerWait");
+
+        GameUtils::Profiler::Instance().SetThreadName("render");
+        m_window->setActive(true);
+        while(m_running)
+        {
+            auto fresh = m_snapshots.AcquireLatest();
+            const auto& snapshot = m_snapshots.GetReadBuffer();
+
+            auto renderStart = std::chrono::steady_clock::now();
+            {
+                GameUtils::ProfileScope scope(drawZone);
+                DrawSnapshot(snapshot, renderStart);
+            }
+            auto renderEnd = std::chrono::steady_clock::now();
+            {
+                GameUtils::ProfileScope scope(displayZone);
+                m_window->display();
+            }
+            auto presented = std::chrono::steady_clock::now();
+
+            m_framePacer.SetIdle(snapshot.idle);
+            {
+                std::lock_guard<std::mutex> lock(m_statsMutex);
+                m_stats.renderMs = Smooth(m_stats.renderMs, renderEnd - renderStart);
+                if(fresh)
+                    m_stats.snapshotLatencyMs = Smooth(m_stats.snapshotLatencyMs, presented - snapshot.publishedAt);
+                else
+                    ++m_stats.repeatedFrames;
+                ++m_stats.frames;
+                m_stats.batch = m_spriteBatch.GetStats();
+                m_stats.batch.drawCalls += snapshot.texts.size();
+                m_stats.pacer = m_framePacer.GetStats();
+                if(m_stats.frames > 1)
+                    m_stats.frameMs = std::chrono::duration<double, std::milli>(presented - m_stats.lastPresent).count();
+                m_stats.lastPresent = presented;
+                m_stats.lastPresentedTick = snapshot.tick;
+            }
+            GameUtils::ProfileScope scope(waitZone);
+            m_framePacer.WaitForNextFrame();
+        }
+        m_window->setActive(false);
+    }
+
+    void RenderThread::DrawSnapshot(const RenderSnapshot& snapshot, const std::chrono::steady_clock::time_point& now)
+    {
+        //Sprites are drawn between their previous and current tick positions, by the time elapsed since the tick
+        auto remainder = 0.0f;
+        if(snapshot.interpolate)
+        {
+            auto elapsed = std::chrono::duration<float>(now - snapshot.publishedAt) / GameUtils::GetTickDuration();
+            remainder = 1.0f - std::clamp(elapsed, 0.0f, 1.0f);
+        }
+
+        m_window->clear(sf::Color::Black);
+        m_spriteBatch.Begin();
+        for(const auto& sprite : snapshot.sprites)
+            m_spriteBatch.Add(sprite.texture, sprite.textureRect, sprite.transform, sprite.color, sprite.layer, -sprite.velocity * remainder);
+        m_spriteBatch.Submit(*m_window);
+
+        for(const auto& text : snapshot.texts)
+            m_window->draw(text);
+    }
+}
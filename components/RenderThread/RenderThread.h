@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "SFML/Graphics.hpp"
+
+#include "RenderSnapshot.h"
+#include "TripleBuffer.h"
+#include "FramePacer/FramePacer.h"
+#include "SpriteBatch/SpriteBatch.h"
+
+namespace GameEngine
+{
+    struct RenderThreadStats
+    {
+        // Smoothed cost of building and submitting a frame, display() excluded
+        double renderMs = 0.0;
+        // Smoothed time between a snapshot being published and the frame showing it being presented
+        double snapshotLatencyMs = 0.0;
+        // Present to present time of the last frame
+        double frameMs = 0.0;
+        std::size_t frames = 0;
+        // Frames presented again from a snapshot that was already shown
+        std::size_t repeatedFrames = 0;
+        SpriteBatchStats batch;
+        FramePacerStats pacer;
+        std::chrono::steady_clock::time_point lastPresent;
+        // Tick of the snapshot shown by the last presented frame
+        GameUtils::Tick lastPresentedTick = 0;
+    };
+
+    // Owns the window's GL context on a dedicated thread and presents the newest published snapshot.
+    // The simulation only writes snapshots and never touches the context while the thread runs.
+    class RenderThread
+    {
+    public:
+        RenderThread() = default;
+        ~RenderThread();
+
+        RenderThread(const RenderThread&) = delete;
+        RenderThread& operator=(const RenderThread&) = delete;
+
+        // The pacer is configured before Start and only used by the render thread afterwards
+        FramePacer& GetFramePacer();
+        void Start(const std::shared_ptr<sf::RenderWindow>& window);
+        void Stop();
+        bool IsRunning() const;
+
+        // Cleared snapshot owned by the simulation until Publish
+        RenderSnapshot& BeginSnapshot();
+        void Publish();
+
+        RenderThreadStats GetStats() const;
+
+    private:
+        std::shared_ptr<sf::RenderWindow> m_window;
+        std::thread m_thread;
+        std::atomic<bool> m_running = false;
+
+        TripleBuffer<RenderSnapshot> m_snapshots;
+        SpriteBatch m_spriteBatch;
+        FramePacer m_framePacer;
+
+        mutable std::mutex m_statsMutex;
+        RenderThreadStats m_stats;
+
+        void Run();
+        void DrawSnapshot(const RenderSnapshot& snapshot, const std::chrono::steady_clock::time_point& now);
+    };
+}
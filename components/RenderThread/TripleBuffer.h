@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace GameEngine
+{
+    // Single producer, single consumer hand-off: the writer fills its own buffer and swaps it into the shared slot,
+    // the reader swaps the shared slot out when it holds something new. Neither side ever waits on the other.
+    template<typename T>
+    class TripleBuffer
+    {
+    public:
+        T& GetWriteBuffer()
+        {
+            return m_buffers[m_writeIndex];
+        }
+
+        void Publish()
+        {
+            auto previous = m_shared.exchange(static_cast<uint8_t>(m_writeIndex | freshBit), std::memory_order_acq_rel);
+            m_writeIndex = previous & indexMask;
+        }
+
+        // Returns false and keeps the current read buffer when nothing was published since the last call
+        bool AcquireLatest()
+        {
+            if((m_shared.load(std::memory_order_relaxed) & freshBit) == 0) return false;
+            auto previous = m_shared.exchange(m_readIndex, std::memory_order_acq_rel);
+            m_readIndex = previous & indexMask;
+            return true;
+        }
+
+        const T& GetReadBuffer() const
+        {
+            return m_buffers[m_readIndex];
+        }
+
+    private:
+        static constexpr uint8_t indexMask = 0x3;
+        static constexpr uint8_t freshBit = 0x4;
+
+        std::array<T, 3> m_buffers;
+        uint8_t m_writeIndex = 0;
+        uint8_t m_readIndex = 1;
+        std::atomic<uint8_t> m_shared{2};
+    };
+}
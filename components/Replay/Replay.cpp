@@ -0,0 +1,224 @@
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+
+#include "Replay.h"
+
+namespace GameEngine
+{
+    namespace
+    {
+        constexpr char replayMagic[4] = {'S', 'I', 'R', 'P'};
+        //A day of play at 60 ticks per second, longer headers are treated as corrupt
+        constexpr uint32_t maxReplayTicks = 60 * 60 * 60 * 24;
+
+        enum InputBit : InputMask
+        {
+            LEFT = 1 << 0,
+            RIGHT = 1 << 1,
+            FIRE = 1 << 2,
+            PAUSE = 1 << 3,
+            CONFIRM = 1 << 4
+        };
+
+        uint32_t ChainHash(const uint32_t& previous, const uint64_t& stateHash)
+        {
+            auto mixed = stateHash ^ (previous * 0x9E3779B97F4A7C15ULL);
+            mixed = (mixed ^ (mixed >> 31)) * 0xBF58476D1CE4E5B9ULL;
+            return static_cast<uint32_t>(mixed ^ (mixed >> 32));
+        }
+
+        template<typename T>
+        void Write(std::vector<char>& buffer, const T& value)
+        {
+            for(std::size_t byte = 0; byte < sizeof(T); ++byte)
+                buffer.push_back(static_cast<char>((static_cast<uint64_t>(value) >> (8 * byte)) & 0xFF));
+        }
+
+        void WriteVarint(std::vector<char>& buffer, uint32_t value)
+        {
+            while(value >= 0x80)
+            {
+                buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+                value >>= 7;
+            }
+            buffer.push_back(static_cast<char>(value));
+        }
+
+        class Reader
+        {
+        public:
+            explicit Reader(const std::vector<char>& buffer) : m_buffer(buffer) {}
+
+            template<typename T>
+            bool Read(T& value)
+            {
+                if(m_position + sizeof(T) > m_buffer.size()) return false;
+                uint64_t result = 0;
+                for(std::size_t byte = 0; byte < sizeof(T); ++byte)
+                    result |= static_cast<uint64_t>(static_cast<uint8_t>(m_buffer[m_position++])) << (8 * byte);
+                value = static_cast<T>(result);
+                return true;
+            }
+
+            bool ReadVarint(uint32_t& value)
+            {
+                value = 0;
+                for(auto shift = 0; shift < 35; shift += 7)
+                {
+                    if(m_position >= m_buffer.size()) return false;
+                    auto byte = static_cast<uint8_t>(m_buffer[m_position++]);
+                    value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+                    if((byte & 0x80) == 0) return true;
+                }
+                return false;
+            }
+
+            std::size_t Remaining() const
+            {
+                return m_buffer.size() - m_position;
+            }
+
+        private:
+            const std::vector<char>& m_buffer;
+            std::size_t m_position = 0;
+        };
+    }
+
+    InputMask PackInput(const SimulationInput& input)
+    {
+        return (input.left ? LEFT : 0) | (input.right ? RIGHT : 0) | (input.fire ? FIRE : 0) |
+               (input.pause ? PAUSE : 0) | (input.confirm ? CONFIRM : 0);
+    }
+
+    SimulationInput UnpackInput(const InputMask& mask)
+    {
+        SimulationInput input;
+        input.left = mask & LEFT;
+        input.right = mask & RIGHT;
+        input.fire = mask & FIRE;
+        input.pause = mask & PAUSE;
+        input.confirm = mask & CONFIRM;
+        return input;
+    }
+
+    bool Replay::Save(const std::string& path) const
+    {
+        std::vector<char> buffer(std::begin(replayMagic), std::end(replayMagic));
+        Write(buffer, version);
+        Write(buffer, hashInterval);
+        Write(buffer, seed);
+        Write(buffer, static_cast<uint16_t>(viewportSize.x));
+        Write(buffer, static_cast<uint16_t>(viewportSize.y));
+        Write(buffer, ticks);
+        for(const auto& [mask, length] : inputRuns)
+        {
+            buffer.push_back(static_cast<char>(mask));
+            WriteVarint(buffer, length);
+        }
+        for(auto hash : hashes)
+            Write(buffer, hash);
+
+        std::ofstream file(path, std::ios::binary);
+        if(!file.is_open()) return false;
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        return file.good();
+    }
+
+    bool Replay::Load(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if(!file.is_open()) return false;
+        std::vector<char> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        if(buffer.size() < sizeof(replayMagic) || !std::equal(std::begin(replayMagic), std::end(replayMagic), buffer.begin())) return false;
+        buffer.erase(buffer.begin(), buffer.begin() + sizeof(replayMagic));
+
+        Reader reader(buffer);
+        uint16_t fileVersion, width, height;
+        if(!reader.Read(fileVersion) || fileVersion != version) return false;
+        if(!reader.Read(hashInterval) || !reader.Read(seed) || !reader.Read(width) || !reader.Read(height) || !reader.Read(ticks)) return false;
+        if(hashInterval == 0 || ticks > maxReplayTicks) return false;
+        viewportSize = {width, height};
+
+        inputRuns.clear();
+        uint64_t covered = 0;
+        while(covered < ticks)
+        {
+            InputMask mask;
+            uint32_t length;
+            if(!reader.Read(mask) || !reader.ReadVarint(length) || length == 0 || length > ticks - covered) return false;
+            inputRuns.emplace_back(mask, length);
+            covered += length;
+        }
+
+        //Sizes come from the file, nothing is allocated for hashes the buffer cannot hold
+        auto hashCount = ticks / hashInterval;
+        if(hashCount > reader.Remaining() / sizeof(uint32_t)) return false;
+        hashes.resize(hashCount);
+        for(auto& hash : hashes)
+            if(!reader.Read(hash)) return false;
+        return true;
+    }
+
+    ReplayRecorder::ReplayRecorder(const uint64_t& seed, const sf::Vector2f& viewportSize, const uint16_t& hashInterval)
+    {
+        m_replay.seed = seed;
+        m_replay.viewportSize = {static_cast<unsigned int>(viewportSize.x), static_cast<unsigned int>(viewportSize.y)};
+        m_replay.hashInterval = std::max<uint16_t>(hashInterval, 1);
+    }
+
+    void ReplayRecorder::Record(const SimulationInput& input, const uint64_t& stateHash)
+    {
+        auto mask = PackInput(input);
+        if(!m_replay.inputRuns.empty() && m_replay.inputRuns.back().first == mask)
+            ++m_replay.inputRuns.back().second;
+        else
+            m_replay.inputRuns.emplace_back(mask, 1);
+
+        ++m_replay.ticks;
+        m_chainedHash = ChainHash(m_chainedHash, stateHash);
+        if(m_replay.ticks % m_replay.hashInterval == 0)
+            m_replay.hashes.push_back(m_chainedHash);
+    }
+
+    const Replay& ReplayRecorder::GetReplay() const
+    {
+        return m_replay;
+    }
+
+    ReplayPlayer::ReplayPlayer(const Replay& replay) : m_replay(replay)
+    {
+    }
+
+    bool ReplayPlayer::Finished() const
+    {
+        return m_tick >= m_replay.ticks;
+    }
+
+    SimulationInput ReplayPlayer::Next()
+    {
+        if(Finished()) return {};
+        auto mask = m_replay.inputRuns[m_run].first;
+        if(++m_runTick == m_replay.inputRuns[m_run].second)
+        {
+            ++m_run;
+            m_runTick = 0;
+        }
+        ++m_tick;
+        return UnpackInput(mask);
+    }
+
+    bool ReplayPlayer::Verify(const uint64_t& stateHash)
+    {
+        m_chainedHash = ChainHash(m_chainedHash, stateHash);
+        if(m_tick % m_replay.hashInterval != 0) return true;
+        auto index = m_tick / m_replay.hashInterval - 1;
+        return index >= m_replay.hashes.size() || m_replay.hashes[index] == m_chainedHash;
+    }
+
+    uint32_t ReplayPlayer::GetTick() const
+    {
+        return m_tick;
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+#include "SFML/System.hpp"
+
+#include "GameThread/SimulationState.h"
+
+namespace GameEngine
+{
+    using InputMask = uint8_t;
+
+    InputMask PackInput(const SimulationInput& input);
+    SimulationInput UnpackInput(const InputMask& mask);
+
+    // One recorded session. File layout, little endian:
+    //   header  "SIRP", version u16, hash interval u16, seed u64, viewport width u16, height u16, ticks u32
+    //   inputs  (mask u8, run length as LEB128) pairs covering every tick
+    //   hashes  u32 chained state hash after every hash interval ticks
+    struct Replay
+    {
+        static constexpr uint16_t version = 1;
+
+        uint64_t seed = 0;
+        sf::Vector2u viewportSize;
+        uint16_t hashInterval = 1;
+        uint32_t ticks = 0;
+        std::vector<std::pair<InputMask, uint32_t>> inputRuns;
+        std::vector<uint32_t> hashes;
+
+        bool Save(const std::string& path) const;
+        bool Load(const std::string& path);
+    };
+
+    // Appends one tick at a time, consecutive ticks with the same keys collapse into a single run
+    class ReplayRecorder
+    {
+    public:
+        ReplayRecorder(const uint64_t& seed, const sf::Vector2f& viewportSize, const uint16_t& hashInterval = 1);
+
+        void Record(const SimulationInput& input, const uint64_t& stateHash);
+        const Replay& GetReplay() const;
+
+    private:
+        Replay m_replay;
+        uint32_t m_chainedHash = 0;
+    };
+
+    // Expands the runs back into per tick input and checks the simulation against the recorded hashes
+    class ReplayPlayer
+    {
+    public:
+        explicit ReplayPlayer(const Replay& replay);
+
+        bool Finished() const;
+        SimulationInput Next();
+        // False once the state after the last Next() differs from the recording. Each hash
+        // chains all previous ones, so a desync is caught at the next stored hash at the latest.
+        bool Verify(const uint64_t& stateHash);
+        uint32_t GetTick() const;
+
+    private:
+        const Replay& m_replay;
+        std::size_t m_run = 0;
+        uint32_t m_runTick = 0;
+        uint32_t m_tick = 0;
+        uint32_t m_chainedHash = 0;
+    };
+}
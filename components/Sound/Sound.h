@@ -2,6 +2,7 @@
 
 #include <array>
 #include <string>
+#include <utility>
 
 namespace GameUtils
 {
@@ -29,4 +30,18 @@ namespace GameUtils
             default: return "unknown";
         }
     }
+
+    // Maximum concurrent voices and steal priority of each sound
+    constexpr std::pair<std::size_t, int> SoundVoiceRule(const SoundName& name)
+    {
+        switch(name)
+        {
+            case SoundName::ENEMY_DEATH: return std::make_pair(4, 2);
+            case SoundName::ENEMY_SHOT: return std::make_pair(4, 0);
+            case SoundName::PLAYER_SHOT: return std::make_pair(3, 1);
+            case SoundName::WIN: return std::make_pair(1, 10);
+            case SoundName::LOSE: return std::make_pair(1, 10);
+            default: return std::make_pair(1, 0);
+        }
+    }
 }
\ No newline at end of file
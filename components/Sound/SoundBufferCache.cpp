@@ -0,0 +1,46 @@
+#include "SoundBufferCache.h"
+
+namespace GameUtils
+{
+    SoundBufferCache& SoundBufferCache::Instance()
+    {
+        static SoundBufferCache instance;
+        return instance;
+    }
+
+    std::shared_ptr<const sf::SoundBuffer> SoundBufferCache::Get(const std::string& soundPath)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(auto bufferIter = m_buffers.find(soundPath); bufferIter != m_buffers.end())
+        {
+            ++m_hits;
+            return bufferIter->second;
+        }
+
+        ++m_misses;
+        auto buffer = std::make_shared<sf::SoundBuffer>();
+        buffer->loadFromFile(soundPath);
+        m_buffers[soundPath] = buffer;
+        return buffer;
+    }
+
+    std::size_t SoundBufferCache::GetHits() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_hits;
+    }
+
+    std::size_t SoundBufferCache::GetMisses() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_misses;
+    }
+
+    void SoundBufferCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_buffers.clear();
+        m_hits = 0;
+        m_misses = 0;
+    }
+}
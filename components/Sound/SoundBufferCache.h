@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "SFML/Audio.hpp"
+
+namespace GameUtils
+{
+    class SoundBufferCache
+    {
+    public:
+        static SoundBufferCache& Instance();
+
+        SoundBufferCache(const SoundBufferCache&) = delete;
+        SoundBufferCache& operator=(const SoundBufferCache&) = delete;
+
+        // Decoded samples are shared between every voice playing them, each file is decoded only once.
+        std::shared_ptr<const sf::SoundBuffer> Get(const std::string& soundPath);
+        std::size_t GetHits() const;
+        std::size_t GetMisses() const;
+        void Clear();
+
+    private:
+        SoundBufferCache() = default;
+
+        mutable std::mutex m_mutex;
+        std::unordered_map<std::string, std::shared_ptr<const sf::SoundBuffer>> m_buffers;
+        std::size_t m_hits = 0;
+        std::size_t m_misses = 0;
+    };
+}
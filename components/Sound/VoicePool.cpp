@@ -0,0 +1,122 @@
+#include <algorithm>
+
+#include "VoicePool.h"
+
+using namespace std::chrono_literals;
+
+namespace GameUtils
+{
+    VoicePool::VoicePool(const std::size_t& voiceCount) :
+        m_voices(voiceCount), m_stealWindowStart(std::chrono::steady_clock::now())
+    {}
+
+    void VoicePool::SetBuffer(const SoundName& soundName, const std::shared_ptr<const sf::SoundBuffer>& buffer)
+    {
+        m_buffers[static_cast<int>(soundName)] = buffer;
+    }
+
+    void VoicePool::SetRule(const SoundName& soundName, const std::size_t& maxVoices, const int& priority)
+    {
+        m_rules[static_cast<int>(soundName)] = VoiceRule{std::max<std::size_t>(maxVoices, 1), priority};
+    }
+
+    bool VoicePool::Play(const SoundName& soundName)
+    {
+        UpdateStealRate();
+        if(m_buffers[static_cast<int>(soundName)] == nullptr || m_voices.empty()) return false;
+
+        const auto& rule = m_rules[static_cast<int>(soundName)];
+        Voice* freeVoice = nullptr;
+        Voice* oldestSameSound = nullptr;
+        Voice* stealCandidate = nullptr;
+        std::size_t sameSoundVoices = 0;
+
+        for(auto& voice : m_voices)
+        {
+            if(voice.sound.getStatus() != sf::Sound::Playing)
+            {
+                if(freeVoice == nullptr) freeVoice = &voice;
+                continue;
+            }
+
+            if(voice.soundName == soundName)
+            {
+                ++sameSoundVoices;
+                if(oldestSameSound == nullptr || voice.startTime < oldestSameSound->startTime)
+                    oldestSameSound = &voice;
+            }
+
+            // Lowest priority first, oldest among equals
+            if(voice.priority <= rule.priority && (stealCandidate == nullptr || voice.priority < stealCandidate->priority ||
+                (voice.priority == stealCandidate->priority && voice.startTime < stealCandidate->startTime)))
+                stealCandidate = &voice;
+        }
+
+        if(sameSoundVoices >= rule.maxVoices)
+        {
+            ++m_totalSteals;
+            ++m_stealsInWindow;
+            Start(*oldestSameSound, soundName);
+            return true;
+        }
+
+        if(freeVoice != nullptr)
+        {
+            Start(*freeVoice, soundName);
+            return true;
+        }
+
+        if(stealCandidate != nullptr)
+        {
+            ++m_totalSteals;
+            ++m_stealsInWindow;
+            Start(*stealCandidate, soundName);
+            return true;
+        }
+
+        ++m_droppedPlays;
+        return false;
+    }
+
+    void VoicePool::StopAll()
+    {
+        for(auto& voice : m_voices)
+        {
+            voice.sound.stop();
+            voice.sound.resetBuffer();
+        }
+    }
+
+    VoicePoolStats VoicePool::GetStats()
+    {
+        UpdateStealRate();
+        auto voicesInUse = std::count_if(m_voices.begin(), m_voices.end(), [](const Voice& voice) {
+            return voice.sound.getStatus() == sf::Sound::Playing;
+        });
+        return VoicePoolStats{static_cast<std::size_t>(voicesInUse), m_voices.size(), m_totalSteals, m_droppedPlays, m_stealsPerSecond};
+    }
+
+    void VoicePool::Start(Voice& voice, const SoundName& soundName)
+    {
+        const auto& buffer = m_buffers[static_cast<int>(soundName)];
+        voice.sound.stop();
+        if(voice.sound.getBuffer() != buffer.get())
+            voice.sound.setBuffer(*buffer);
+        voice.soundName = soundName;
+        voice.priority = m_rules[static_cast<int>(soundName)].priority;
+        voice.startTime = std::chrono::steady_clock::now();
+        voice.sound.play();
+    }
+
+    void VoicePool::UpdateStealRate()
+    {
+        auto now = std::chrono::steady_clock::now();
+        auto elapsed = std::chrono::duration<double>(now - m_stealWindowStart);
+        if(elapsed >= 1s)
+        {
+            m_stealsPerSecond = m_stealsInWindow / elapsed.count();
+            m_stealsInWindow = 0;
+            m_stealWindowStart = now;
+        }
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "SFML/Audio.hpp"
+
+#include "Sound.h"
+
+namespace GameUtils
+{
+    struct VoiceRule
+    {
+        std::size_t maxVoices = 1;
+        int priority = 0;
+    };
+
+    struct VoicePoolStats
+    {
+        std::size_t voicesInUse = 0;
+        std::size_t voiceCount = 0;
+        std::size_t totalSteals = 0;
+        std::size_t droppedPlays = 0;
+        double stealsPerSecond = 0.0;
+    };
+
+    class VoicePool
+    {
+    public:
+        explicit VoicePool(const std::size_t& voiceCount = 16);
+
+        void SetBuffer(const SoundName& soundName, const std::shared_ptr<const sf::SoundBuffer>& buffer);
+        void SetRule(const SoundName& soundName, const std::size_t& maxVoices, const int& priority);
+        // Returns false when every voice is busy with a higher priority sound and nothing could be stolen.
+        bool Play(const SoundName& soundName);
+        void StopAll();
+        VoicePoolStats GetStats();
+
+    private:
+        struct Voice
+        {
+            sf::Sound sound;
+            SoundName soundName = SoundName::ENEMY_DEATH;
+            int priority = 0;
+            std::chrono::steady_clock::time_point startTime;
+        };
+
+        std::vector<Voice> m_voices;
+        std::array<std::shared_ptr<const sf::SoundBuffer>, soundFiles.size()> m_buffers;
+        std::array<VoiceRule, soundFiles.size()> m_rules;
+        std::size_t m_totalSteals = 0;
+        std::size_t m_droppedPlays = 0;
+        std::size_t m_stealsInWindow = 0;
+        double m_stealsPerSecond = 0.0;
+        std::chrono::steady_clock::time_point m_stealWindowStart;
+
+        void Start(Voice& voice, const SoundName& soundName);
+        void UpdateStealRate();
+    };
+}
@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+
+#include "SpriteBatch.h"
+
+namespace GameEngine
+{
+    void SpriteBatch::Begin()
+    {
+        //Vertex arrays keep their capacity, steady frames do not allocate
+        for(std::size_t batch = 0; batch < m_activeBatches; batch++)
+            m_batches[batch].vertices.clear();
+        m_activeBatches = 0;
+        m_lastBatch = 0;
+        m_stats = {};
+    }
+
+    SpriteBatchEntry& SpriteBatch::BatchFor(const int& layer, const sf::Texture* texture)
+    {
+        //Consecutive sprites usually share a texture, check the last batch before scanning
+        if(m_lastBatch < m_activeBatches && m_batches[m_lastBatch].layer == layer && m_batches[m_lastBatch].texture == texture)
+            return m_batches[m_lastBatch];
+
+        for(std::size_t batch = 0; batch < m_activeBatches; batch++)
+        {
+            if(m_batches[batch].layer == layer && m_batches[batch].texture == texture)
+            {
+                m_lastBatch = batch;
+                return m_batches[batch];
+            }
+        }
+
+        if(m_activeBatches == m_batches.size())
+            m_batches.push_back({layer, texture, sf::VertexArray(sf::Triangles)});
+        auto& entry = m_batches[m_activeBatches];
+        entry.layer = layer;
+        entry.texture = texture;
+        m_lastBatch = m_activeBatches++;
+        return entry;
+    }
+
+    void SpriteBatch::Add(const sf::Sprite& sprite, const int& layer, const sf::Vector2f& offset)
+    {
+        Add(sprite.getTexture(), sprite.getTextureRect(), sprite.getTransform(), sprite.getColor(), layer, offset);
+    }
+
+    void SpriteBatch::Add(const sf::Texture* texture, const sf::IntRect& textureRect, const sf::Transform& transform, const sf::Color& color,
+            const int& layer, const sf::Vector2f& offset)
+    {
+        if(texture == nullptr) return;
+
+        auto& batch = BatchFor(layer, texture);
+        auto rect = sf::FloatRect(textureRect);
+        auto bounds = sf::FloatRect(0.0f, 0.0f, std::abs(rect.width), std::abs(rect.height));
+
+        sf::Vector2f corners[4] = {
+            transform.transformPoint(0.0f, 0.0f) + offset,
+            transform.transformPoint(bounds.width, 0.0f) + offset,
+            transform.transformPoint(bounds.width, bounds.height) + offset,
+            transform.transformPoint(0.0f, bounds.height) + offset};
+        sf::Vector2f texCoords[4] = {
+            {rect.left, rect.top},
+            {rect.left + rect.width, rect.top},
+            {rect.left + rect.width, rect.top + rect.height},
+            {rect.left, rect.top + rect.height}};
+
+        for(auto corner : {0, 1, 2, 0, 2, 3})
+            batch.vertices.append(sf::Vertex(corners[corner], color, texCoords[corner]));
+        ++m_stats.sprites;
+    }
+
+    void SpriteBatch::Submit(sf::RenderTarget& target, const sf::RenderStates& states)
+    {
+        m_order.resize(m_activeBatches);
+        std::iota(m_order.begin(), m_order.end(), 0);
+        //Batches are opened in submission order, so the index breaks ties deterministically, never the texture address
+        std::sort(m_order.begin(), m_order.end(), [this](const std::size_t& lhs, const std::size_t& rhs){
+            if(m_batches[lhs].layer != m_batches[rhs].layer) return m_batches[lhs].layer < m_batches[rhs].layer;
+            return lhs < rhs;
+        });
+
+        const sf::Texture* boundTexture = nullptr;
+        for(auto batch : m_order)
+        {
+            auto& entry = m_batches[batch];
+            if(entry.vertices.getVertexCount() == 0) continue;
+            auto batchStates = states;
+            batchStates.texture = entry.texture;
+            target.draw(entry.vertices, batchStates);
+            ++m_stats.drawCalls;
+            if(entry.texture != boundTexture) ++m_stats.textureBinds;
+            boundTexture = entry.texture;
+        }
+        m_stats.batches = m_activeBatches;
+    }
+
+    SpriteBatchStats SpriteBatch::GetStats() const
+    {
+        return m_stats;
+    }
+}
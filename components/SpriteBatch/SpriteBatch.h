@@ -0,0 +1,52 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+#include "SFML/Graphics.hpp"
+
+namespace GameEngine
+{
+    struct SpriteBatchStats
+    {
+        std::size_t drawCalls = 0;
+        std::size_t sprites = 0;
+        std::size_t batches = 0;
+        // Draw calls that switched to a different texture than the previous one
+        std::size_t textureBinds = 0;
+    };
+
+    struct SpriteBatchEntry
+    {
+        int layer;
+        const sf::Texture* texture;
+        sf::VertexArray vertices;
+    };
+
+    // Collects sprites for one frame and draws every (layer, texture) pair with a single vertex array
+    class SpriteBatch
+    {
+    public:
+        SpriteBatch() = default;
+
+        void Begin();
+        // offset is added in world space, used for interpolated positions without touching the sprite
+        void Add(const sf::Sprite& sprite, const int& layer = 0, const sf::Vector2f& offset = {0.0f, 0.0f});
+        // Same as above from the parts of a sprite, used for sprites copied out of the simulation
+        void Add(const sf::Texture* texture, const sf::IntRect& textureRect, const sf::Transform& transform, const sf::Color& color,
+            const int& layer = 0, const sf::Vector2f& offset = {0.0f, 0.0f});
+        // Lower layers are drawn first. Sprites of a layer are grouped by texture, the groups are drawn in the order
+        // their first sprite was added, so the same submissions always draw in the same order
+        void Submit(sf::RenderTarget& target, const sf::RenderStates& states = sf::RenderStates::Default);
+        SpriteBatchStats GetStats() const;
+
+    private:
+        std::vector<SpriteBatchEntry> m_batches;
+        std::vector<std::size_t> m_order;
+        std::size_t m_activeBatches = 0;
+        std::size_t m_lastBatch = 0;
+        SpriteBatchStats m_stats;
+
+        SpriteBatchEntry& BatchFor(const int& layer, const sf::Texture* texture);
+    };
+}
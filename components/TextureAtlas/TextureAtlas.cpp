@@ -0,0 +1,156 @@
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <tuple>
+#include <vector>
+#include <algorithm>
+
+#include "TextureAtlas.h"
+#include "TextureCache/TextureCache.h"
+
+namespace GameUtils
+{
+    sf::IntRect AtlasSprite::FrameRect(const int& row, const int& frame) const
+    {
+        if(row < 0 || row >= rows || frame < 0 || frame >= columns)
+            return sf::IntRect{empty.getPosition(), frameSize};
+        return sf::IntRect{{rect.left + frame * frameSize.x, rect.top + row * frameSize.y}, frameSize};
+    }
+
+    TextureAtlas& TextureAtlas::Instance()
+    {
+        static TextureAtlas instance;
+        return instance;
+    }
+
+    bool TextureAtlas::Load(const std::string& tablePath)
+    {
+        Clear();
+        std::ifstream table(tablePath);
+        if(!table.is_open()) return false;
+
+        auto tableDir = std::filesystem::path(tablePath).parent_path();
+        std::string line;
+        while(std::getline(table, line))
+        {
+            std::istringstream fields(line);
+            std::string kind;
+            fields >> kind;
+            if(kind == "page")
+            {
+                std::size_t index;
+                std::string pageName;
+                sf::IntRect empty;
+                fields >> index >> pageName >> empty.left >> empty.top >> empty.width >> empty.height;
+                if(fields.fail()) continue;
+                if(m_pages.size() <= index) m_pages.resize(index + 1);
+                auto pagePath = (tableDir / pageName).string();
+                m_pages[index] = {TextureCache::Instance().Get(pagePath), pagePath, empty};
+            }
+            else if(kind == "sprite")
+            {
+                std::string name;
+                std::size_t page;
+                AtlasSprite sprite;
+                fields >> name >> page >> sprite.rect.left >> sprite.rect.top >> sprite.rect.width >> sprite.rect.height >> sprite.frameSize.x >> sprite.frameSize.y;
+                if(fields.fail() || page >= m_pages.size() || sprite.frameSize.x <= 0 || sprite.frameSize.y <= 0) continue;
+                std::tie(sprite.page, sprite.pagePath, sprite.empty) = m_pages[page];
+                sprite.columns = sprite.rect.width / sprite.frameSize.x;
+                sprite.rows = sprite.rect.height / sprite.frameSize.y;
+                m_sprites[name] = std::move(sprite);
+            }
+        }
+        return !m_sprites.empty();
+    }
+
+    const AtlasSprite* TextureAtlas::Find(const std::string& texturePath) const
+    {
+        if(m_sprites.empty()) return nullptr;
+        auto spriteIter = m_sprites.find(std::filesystem::path(texturePath).filename().string());
+        if(spriteIter == m_sprites.end() || spriteIter->second.page == nullptr) return nullptr;
+        return &spriteIter->second;
+    }
+
+    const AtlasSprite* TextureAtlas::FindVariant(const std::string& texturePath, const Palette& palette)
+    {
+        auto sprite = Find(texturePath);
+        if(sprite == nullptr) return nullptr;
+
+        std::lock_guard<std::mutex> lock(m_variantMutex);
+        auto variantKey = std::filesystem::path(texturePath).filename().string() + "#" + palette.GetName();
+        if(auto variantIter = m_variants.find(variantKey); variantIter != m_variants.end())
+            return &variantIter->second;
+
+        //The sheet is followed by one transparent cell, the variant's empty frame
+        sf::Vector2i size{sprite->rect.width + sprite->frameSize.x, sprite->rect.height};
+        if(m_variantCursor.x + size.x > variantPageSize)
+        {
+            m_variantCursor = {0, m_variantCursor.y + m_variantShelfHeight};
+            m_variantShelfHeight = 0;
+        }
+        if(size.x > variantPageSize || m_variantCursor.y + size.y > variantPageSize) return nullptr;
+
+        auto pageIter = m_pageImages.find(sprite->pagePath);
+        if(pageIter == m_pageImages.end())
+        {
+            sf::Image page;
+            if(!page.loadFromFile(sprite->pagePath)) return nullptr;
+            pageIter = m_pageImages.emplace(sprite->pagePath, std::move(page)).first;
+        }
+
+        sf::Image cell;
+        cell.create(size.x, size.y, sf::Color::Transparent);
+        cell.copy(pageIter->second, 0, 0, sprite->rect);
+        std::vector<sf::Uint8> pixels(cell.getPixelsPtr(), cell.getPixelsPtr() + size.x * size.y * 4);
+        RemapPixels(pixels.data(), static_cast<std::size_t>(size.x) * size.y, palette);
+        cell.create(size.x, size.y, pixels.data());
+
+        if(m_variantPage == nullptr)
+        {
+            sf::Image blank;
+            blank.create(variantPageSize, variantPageSize, sf::Color::Transparent);
+            m_variantPage = std::make_shared<sf::Texture>();
+            m_variantPage->loadFromImage(blank);
+        }
+        m_variantPage->update(cell, m_variantCursor.x, m_variantCursor.y);
+
+        AtlasSprite variant = *sprite;
+        variant.page = m_variantPage;
+        variant.pagePath.clear();
+        variant.rect = sf::IntRect{m_variantCursor, sprite->rect.getSize()};
+        variant.empty = sf::IntRect{{m_variantCursor.x + sprite->rect.width, m_variantCursor.y}, sprite->frameSize};
+
+        m_variantCursor.x += size.x;
+        m_variantShelfHeight = std::max(m_variantShelfHeight, size.y);
+        return &(m_variants[variantKey] = std::move(variant));
+    }
+
+    std::size_t TextureAtlas::GetVariantCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_variantMutex);
+        return m_variants.size();
+    }
+
+    std::size_t TextureAtlas::GetPageCount() const
+    {
+        return m_pages.size();
+    }
+
+    std::size_t TextureAtlas::GetSpriteCount() const
+    {
+        return m_sprites.size();
+    }
+
+    void TextureAtlas::Clear()
+    {
+        m_pages.clear();
+        m_sprites.clear();
+
+        std::lock_guard<std::mutex> lock(m_variantMutex);
+        m_variantPage.reset();
+        m_variantCursor = {0, 0};
+        m_variantShelfHeight = 0;
+        m_pageImages.clear();
+        m_variants.clear();
+    }
+}
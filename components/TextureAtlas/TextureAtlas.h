@@ -0,0 +1,70 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <tuple>
+#include <unordered_map>
+
+#include "SFML/Graphics.hpp"
+
+#include "Palette/Palette.h"
+
+namespace GameUtils
+{
+    // Sprite sheet placed inside an atlas page, frames are laid out in rows of frameSize cells
+    struct AtlasSprite
+    {
+        std::shared_ptr<const sf::Texture> page;
+        std::string pagePath;
+        sf::IntRect rect;
+        // Transparent cell of the page, used for frames that fall outside the sheet
+        sf::IntRect empty;
+        sf::Vector2i frameSize;
+        int columns;
+        int rows;
+
+        sf::IntRect FrameRect(const int& row, const int& frame) const;
+    };
+
+    // Frame table written by tools/AtlasPacker, read once at startup and immutable afterwards.
+    // Palette variants of sheets are packed at runtime into one shared variant page, so recolored sprites batch together.
+    class TextureAtlas
+    {
+    public:
+        static TextureAtlas& Instance();
+
+        TextureAtlas(const TextureAtlas&) = delete;
+        TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+        // Returns false when the table is missing, sprites then fall back to standalone textures
+        bool Load(const std::string& tablePath);
+        // Sheets are looked up by file name, so any path to the original png finds its atlas entry
+        const AtlasSprite* Find(const std::string& texturePath) const;
+        // Recolored copy of the sheet with the same frame layout. Only the sheet's own rect is remapped, on the first
+        // request for (sheet, palette). nullptr when the sheet is not atlased or the variant page is full.
+        const AtlasSprite* FindVariant(const std::string& texturePath, const Palette& palette);
+        std::size_t GetPageCount() const;
+        std::size_t GetSpriteCount() const;
+        std::size_t GetVariantCount() const;
+        void Clear();
+
+    private:
+        TextureAtlas() = default;
+
+        static constexpr int variantPageSize = 1024;
+
+        std::vector<std::tuple<std::shared_ptr<const sf::Texture>, std::string, sf::IntRect>> m_pages;
+        std::unordered_map<std::string, AtlasSprite> m_sprites;
+
+        mutable std::mutex m_variantMutex;
+        std::shared_ptr<sf::Texture> m_variantPage;
+        // Shelf packing cursor of the variant page
+        sf::Vector2i m_variantCursor;
+        int m_variantShelfHeight = 0;
+        // Decoded source pages, a page is read from disk once for all of its variants
+        std::unordered_map<std::string, sf::Image> m_pageImages;
+        std::unordered_map<std::string, AtlasSprite> m_variants;
+    };
+}
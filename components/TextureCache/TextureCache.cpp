@@ -0,0 +1,170 @@
+#include <array>
+#include <algorithm>
+#include <vector>
+#include <fstream>
+
+#include "TextureCache.h"
+
+namespace GameUtils
+{
+    namespace
+    {
+        std::unique_ptr<TextureCache>& ProcessCache()
+        {
+            static auto cache = std::make_unique<TextureCache>();
+            return cache;
+        }
+
+        //Width and height are the first fields of the IHDR chunk, right after the signature and chunk header
+        bool ReadPngSize(const std::string& path, sf::Vector2u& size)
+        {
+            constexpr std::array<unsigned char, 8> signature = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+            std::array<unsigned char, 24> header;
+            std::ifstream file(path, std::ios::binary);
+            if(!file.read(reinterpret_cast<char*>(header.data()), header.size())) return false;
+            if(!std::equal(signature.begin(), signature.end(), header.begin()) || !std::equal(header.begin() + 12, header.begin() + 16, "IHDR")) return false;
+
+            auto readBigEndian = [&header](const std::size_t& offset)
+            {
+                return (static_cast<unsigned int>(header[offset]) << 24) | (static_cast<unsigned int>(header[offset + 1]) << 16) |
+                       (static_cast<unsigned int>(header[offset + 2]) << 8) | static_cast<unsigned int>(header[offset + 3]);
+            };
+            size = {readBigEndian(16), readBigEndian(20)};
+            return true;
+        }
+    }
+
+    TextureCache::TextureCache(const TextureCacheConfig& config) : m_config(config)
+    {
+    }
+
+    TextureCache& TextureCache::Instance()
+    {
+        return *ProcessCache();
+    }
+
+    void TextureCache::Configure(const TextureCacheConfig& config)
+    {
+        ProcessCache() = std::make_unique<TextureCache>(config);
+    }
+
+    std::shared_ptr<const sf::Texture> TextureCache::Get(const std::string& texturePath)
+    {
+        if(m_config.headless) return nullptr;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(auto textureIter = m_textures.find(texturePath); textureIter != m_textures.end())
+        {
+            ++m_hits;
+            return textureIter->second;
+        }
+
+        ++m_misses;
+        ++m_loadCounts[texturePath];
+        auto texture = std::make_shared<sf::Texture>();
+        texture->loadFromFile(texturePath);
+        m_textures[texturePath] = texture;
+        return texture;
+    }
+
+    std::shared_ptr<const sf::Texture> TextureCache::GetVariant(const std::string& texturePath, const std::string& variant, const std::function<void(sf::Image&)>& imageTransform)
+    {
+        if(m_config.headless) return nullptr;
+        auto variantKey = texturePath + "#" + variant;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if(auto textureIter = m_textures.find(variantKey); textureIter != m_textures.end())
+            {
+                ++m_hits;
+                return textureIter->second;
+            }
+        }
+
+        auto image = Get(texturePath)->copyToImage();
+        imageTransform(image);
+        auto texture = std::make_shared<sf::Texture>();
+        texture->loadFromImage(image);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_misses;
+        return m_textures.try_emplace(variantKey, texture).first->second;
+    }
+
+    std::shared_ptr<const sf::Texture> TextureCache::GetPalette(const std::string& texturePath, const Palette& palette)
+    {
+        return GetVariant(texturePath, "palette:" + palette.GetName(), [&palette](sf::Image& image)
+        {
+            auto size = image.getSize();
+            std::vector<sf::Uint8> pixels(image.getPixelsPtr(), image.getPixelsPtr() + size.x * size.y * 4);
+            RemapPixels(pixels.data(), size.x * size.y, palette);
+            image.create(size.x, size.y, pixels.data());
+        });
+    }
+
+    sf::Vector2u TextureCache::GetTextureSize(const std::string& texturePath)
+    {
+        if(!IsHeadless())
+        {
+            auto texture = Get(texturePath);
+            return texture->getSize();
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(auto sizeIter = m_headlessSizes.find(texturePath); sizeIter != m_headlessSizes.end())
+        {
+            ++m_hits;
+            return sizeIter->second;
+        }
+
+        ++m_misses;
+        sf::Vector2u size;
+        if(!ReadPngSize(texturePath, size))
+        {
+            //Not a png, only then the whole image is decoded for its size
+            ++m_loadCounts[texturePath];
+            sf::Image image;
+            image.loadFromFile(texturePath);
+            size = image.getSize();
+        }
+        return m_headlessSizes[texturePath] = size;
+    }
+
+    bool TextureCache::IsHeadless() const
+    {
+        return m_config.headless;
+    }
+
+    std::size_t TextureCache::GetHits() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_hits;
+    }
+
+    std::size_t TextureCache::GetMisses() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_misses;
+    }
+
+    std::size_t TextureCache::GetLoadCount(const std::string& texturePath) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto countIter = m_loadCounts.find(texturePath);
+        return countIter != m_loadCounts.end() ? countIter->second : 0;
+    }
+
+    std::size_t TextureCache::GetSize() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_textures.size();
+    }
+
+    void TextureCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_textures.clear();
+        m_headlessSizes.clear();
+        m_loadCounts.clear();
+        m_hits = 0;
+        m_misses = 0;
+    }
+}
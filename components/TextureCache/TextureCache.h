@@ -0,0 +1,61 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <functional>
+#include <unordered_map>
+
+#include "SFML/Graphics.hpp"
+
+#include "Palette/Palette.h"
+
+namespace GameUtils
+{
+    struct TextureCacheConfig
+    {
+        // No texture is ever created: Get returns nullptr and sizes are read from the image file headers
+        bool headless = false;
+    };
+
+    class TextureCache
+    {
+    public:
+        explicit TextureCache(const TextureCacheConfig& config = {});
+
+        // Process wide cache used by objects, the atlas and the background
+        static TextureCache& Instance();
+        // Replaces the process wide cache with an empty one built from config, each GameThread does so for its mode.
+        // Textures handed out by the previous cache stay valid, they are shared.
+        static void Configure(const TextureCacheConfig& config);
+
+        TextureCache(const TextureCache&) = delete;
+        TextureCache& operator=(const TextureCache&) = delete;
+
+        // Textures handed out are shared and immutable, every path is decoded once per cache: Configure starts over.
+        // In headless mode no texture is created and nullptr is returned.
+        std::shared_ptr<const sf::Texture> Get(const std::string& texturePath);
+        // Recolored copy of texturePath, built once through imageTransform and cached under (texturePath, variant).
+        std::shared_ptr<const sf::Texture> GetVariant(const std::string& texturePath, const std::string& variant, const std::function<void(sf::Image&)>& imageTransform);
+        // Palette variant of texturePath cached under (texturePath, palette name), pixels are remapped once
+        std::shared_ptr<const sf::Texture> GetPalette(const std::string& texturePath, const Palette& palette);
+        // Pixel size of the texture at texturePath. In headless mode only the file header is read, once per path.
+        sf::Vector2u GetTextureSize(const std::string& texturePath);
+        bool IsHeadless() const;
+        std::size_t GetHits() const;
+        std::size_t GetMisses() const;
+        // Times texturePath was decoded from disk by this cache
+        std::size_t GetLoadCount(const std::string& texturePath) const;
+        std::size_t GetSize() const;
+        void Clear();
+
+    private:
+        const TextureCacheConfig m_config;
+        mutable std::mutex m_mutex;
+        std::unordered_map<std::string, std::shared_ptr<const sf::Texture>> m_textures;
+        std::unordered_map<std::string, sf::Vector2u> m_headlessSizes;
+        std::unordered_map<std::string, std::size_t> m_loadCounts;
+        std::size_t m_hits = 0;
+        std::size_t m_misses = 0;
+    };
+}
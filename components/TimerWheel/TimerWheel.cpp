@@ -0,0 +1,185 @@
+#include <bit>
+#include <algorithm>
+
+#include "TimerWheel.h"
+#include "Profiler/Profiler.h"
+
+namespace GameUtils
+{
+    TimerWheel& TimerWheel::Instance()
+    {
+        static TimerWheel instance;
+        return instance;
+    }
+
+    std::array<std::array<uint32_t, TimerWheel::slotCount>, TimerWheel::levelCount> TimerWheel::MakeEmptySlots()
+    {
+        std::array<std::array<uint32_t, slotCount>, levelCount> slots;
+        for(auto& level : slots)
+            level.fill(nullNode);
+        return slots;
+    }
+
+    TimerHandle TimerWheel::Schedule(const Tick& delay, std::function<void()> callback)
+    {
+        uint32_t node;
+        if(!m_freeNodes.empty())
+        {
+            node = m_freeNodes.back();
+            m_freeNodes.pop_back();
+        }
+        else
+        {
+            node = static_cast<uint32_t>(m_nodes.size());
+            m_nodes.emplace_back();
+        }
+
+        auto& entry = m_nodes[node];
+        entry.deadline = m_currentTick + std::max<Tick>(delay, 1);
+        entry.callback = std::move(callback);
+        entry.active = true;
+        ++m_activeCount;
+        Link(node);
+        return {node, entry.generation};
+    }
+
+    bool TimerWheel::Cancel(const TimerHandle& handle)
+    {
+        if(!IsActive(handle)) return false;
+        Unlink(handle.index);
+        Release(handle.index);
+        return true;
+    }
+
+    bool TimerWheel::IsActive(const TimerHandle& handle) const
+    {
+        return handle.index < m_nodes.size() && m_nodes[handle.index].active && m_nodes[handle.index].generation == handle.generation;
+    }
+
+    Tick TimerWheel::GetRemaining(const TimerHandle& handle) const
+    {
+        if(!IsActive(handle)) return 0;
+        return m_nodes[handle.index].deadline - m_currentTick;
+    }
+
+    void TimerWheel::Advance(const Tick& tick)
+    {
+        static const auto zone = Profiler::Instance().RegisterZone("TimerWheel");
+        ProfileScope scope(zone);
+        //Ticks restarted behind the wheel, pending timers belong to the previous run
+        if(tick < m_currentTick)
+        {
+            Clear();
+            m_currentTick = tick;
+            return;
+        }
+
+        while(m_currentTick < tick)
+        {
+            if(m_activeCount == 0)
+            {
+                m_currentTick = tick;
+                return;
+            }
+
+            ++m_currentTick;
+            //Higher levels first, a cascaded timer may land in a lower slot that is due on this same tick
+            if((m_currentTick & ((Tick{1} << (slotBits * levelCount)) - 1)) == 0)
+                Cascade(m_overflow);
+            for(auto level = levelCount - 1; level > 0; --level)
+            {
+                if((m_currentTick & ((Tick{1} << (slotBits * level)) - 1)) == 0)
+                    Cascade(m_slots[level][(m_currentTick >> (slotBits * level)) & (slotCount - 1)]);
+            }
+
+            auto& dueSlot = m_slots[0][m_currentTick & (slotCount - 1)];
+            while(dueSlot != nullNode)
+            {
+                auto node = dueSlot;
+                Unlink(node);
+                auto callback = std::move(m_nodes[node].callback);
+                Release(node);
+                if(callback) callback();
+            }
+        }
+    }
+
+    void TimerWheel::Clear()
+    {
+        //Nodes are kept so generations keep growing and handles from before the clear stay inactive
+        m_freeNodes.clear();
+        for(uint32_t node = 0; node < m_nodes.size(); ++node)
+        {
+            auto& entry = m_nodes[node];
+            if(entry.active) ++entry.generation;
+            entry = Node{0, nullptr, nullNode, nullNode, entry.generation, nullptr, false};
+            m_freeNodes.push_back(node);
+        }
+        m_slots = MakeEmptySlots();
+        m_overflow = nullNode;
+        m_activeCount = 0;
+    }
+
+    std::size_t TimerWheel::GetActiveCount() const
+    {
+        return m_activeCount;
+    }
+
+    Tick TimerWheel::GetCurrentTick() const
+    {
+        return m_currentTick;
+    }
+
+    void TimerWheel::Link(const uint32_t& node)
+    {
+        //The level is given by the highest bit where the deadline differs from the current tick
+        auto& entry = m_nodes[node];
+        auto differingBits = static_cast<int>(std::bit_width(entry.deadline ^ m_currentTick));
+        auto level = differingBits > 0 ? (differingBits - 1) / slotBits : 0;
+        auto& list = level < static_cast<int>(levelCount)
+            ? m_slots[level][(entry.deadline >> (slotBits * level)) & (slotCount - 1)]
+            : m_overflow;
+
+        entry.list = &list;
+        entry.previous = nullNode;
+        entry.next = list;
+        if(list != nullNode)
+            m_nodes[list].previous = node;
+        list = node;
+    }
+
+    void TimerWheel::Unlink(const uint32_t& node)
+    {
+        auto& entry = m_nodes[node];
+        if(entry.previous != nullNode)
+            m_nodes[entry.previous].next = entry.next;
+        else
+            *entry.list = entry.next;
+        if(entry.next != nullNode)
+            m_nodes[entry.next].previous = entry.previous;
+        entry.previous = entry.next = nullNode;
+        entry.list = nullptr;
+    }
+
+    void TimerWheel::Release(const uint32_t& node)
+    {
+        auto& entry = m_nodes[node];
+        entry.active = false;
+        entry.callback = nullptr;
+        ++entry.generation;
+        --m_activeCount;
+        m_freeNodes.push_back(node);
+    }
+
+    void TimerWheel::Cascade(uint32_t& list)
+    {
+        auto node = list;
+        list = nullNode;
+        while(node != nullNode)
+        {
+            auto next = m_nodes[node].next;
+            Link(node);
+            node = next;
+        }
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <functional>
+
+#include "GameUtils/GameUtils.h"
+
+namespace GameUtils
+{
+    // Slot in the TimerWheel plus the generation it was issued for, expired or cancelled handles are never active.
+    struct TimerHandle
+    {
+        static constexpr uint32_t invalidIndex = std::numeric_limits<uint32_t>::max();
+
+        uint32_t index = invalidIndex;
+        uint32_t generation = 0;
+
+        constexpr bool IsValid() const
+        {
+            return index != invalidIndex;
+        }
+
+        constexpr bool operator==(const TimerHandle& other) const = default;
+    };
+
+    // Hierarchical timer wheel over simulation ticks: four levels of 64 slots cover 2^24 ticks,
+    // later deadlines wait in an overflow list. Schedule and Cancel are O(1), Advance touches only due slots.
+    class TimerWheel
+    {
+    public:
+        static TimerWheel& Instance();
+
+        TimerWheel(const TimerWheel&) = delete;
+        TimerWheel& operator=(const TimerWheel&) = delete;
+
+        // Expires delay ticks after the current one, a zero delay expires on the next tick.
+        // Timers without callback only act as flags polled through IsActive.
+        TimerHandle Schedule(const Tick& delay, std::function<void()> callback = nullptr);
+        bool Cancel(const TimerHandle& handle);
+        bool IsActive(const TimerHandle& handle) const;
+        Tick GetRemaining(const TimerHandle& handle) const;
+        // Expires every timer due up to and including tick, running their callbacks in deadline order
+        void Advance(const Tick& tick);
+        void Clear();
+        std::size_t GetActiveCount() const;
+        Tick GetCurrentTick() const;
+
+    private:
+        TimerWheel() = default;
+
+        static constexpr int slotBits = 6;
+        static constexpr std::size_t slotCount = 1 << slotBits;
+        static constexpr std::size_t levelCount = 4;
+        static constexpr uint32_t nullNode = std::numeric_limits<uint32_t>::max();
+
+        struct Node
+        {
+            Tick deadline = 0;
+            std::function<void()> callback;
+            uint32_t previous = nullNode;
+            uint32_t next = nullNode;
+            uint32_t generation = 0;
+            uint32_t* list = nullptr;
+            bool active = false;
+        };
+
+        std::vector<Node> m_nodes;
+        std::vector<uint32_t> m_freeNodes;
+        std::array<std::array<uint32_t, slotCount>, levelCount> m_slots = MakeEmptySlots();
+        uint32_t m_overflow = nullNode;
+        Tick m_currentTick = 0;
+        std::size_t m_activeCount = 0;
+
+        static std::array<std::array<uint32_t, slotCount>, levelCount> MakeEmptySlots();
+        void Link(const uint32_t& node);
+        void Unlink(const uint32_t& node);
+        void Release(const uint32_t& node);
+        void Cascade(uint32_t& list);
+    };
+}
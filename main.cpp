@@ -1,17 +1,48 @@
 #include <SFML/Window.hpp>
 #include <SFML/Graphics.hpp>
 
+#include <string>
+
 #include "GameThread/GameThread.h"
+#include "Random/Random.h"
+#include "Replay/Replay.h"
+#include "Profiler/Profiler.h"
 
-int main()
+// Headless runs, replays and benchmarks are in the GameTools console program
+int main(int argc, char* argv[])
 {
+    //--seed N fixes the session seed, --record path saves the session as a replay on exit,
+    //--profile path writes a Chrome trace of the session on exit
+    std::string recordPath;
+    std::string tracePath;
+    GameUtils::Random::Instance().Seed(GameUtils::Random::EntropySeed());
+    for(int arg = 1; arg + 1 < argc; arg += 2)
+    {
+        if(std::string(argv[arg]) == "--seed")
+            GameUtils::Random::Instance().Seed(std::stoull(argv[arg + 1]));
+        else if(std::string(argv[arg]) == "--record")
+            recordPath = argv[arg + 1];
+        else if(std::string(argv[arg]) == "--profile")
+            tracePath = argv[arg + 1];
+    }
+
     std::shared_ptr<sf::RenderWindow> window = std::make_shared<sf::RenderWindow>(sf::VideoMode(800,600), "Space Invader", sf::Style::Default);
     auto icon = sf::Image{};
     icon.loadFromFile("../images/icon.png");
     window->setIcon(icon.getSize().x, icon.getSize().y, icon.getPixelsPtr());
 
     GameEngine::GameThread gameThread(window);
+    auto recorder = std::make_shared<GameEngine::ReplayRecorder>(GameUtils::Random::Instance().GetSeed(), gameThread.GetViewportSize());
+    if(!recordPath.empty())
+        gameThread.SetRecorder(recorder);
+    GameUtils::Profiler::Instance().SetThreadName("simulation");
+    GameUtils::Profiler::Instance().SetEnabled(!tracePath.empty());
     gameThread.GameWatcherThread();
-    
+
+    GameUtils::Profiler::Instance().SetEnabled(false);
+    if(!tracePath.empty())
+        GameUtils::Profiler::Instance().ExportChromeTrace(tracePath);
+    if(!recordPath.empty())
+        recorder->GetReplay().Save(recordPath);
     return 0;
-}
\ No newline at end of file
+}
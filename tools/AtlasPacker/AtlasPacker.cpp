@@ -0,0 +1,198 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "SFML/Graphics.hpp"
+
+// Packs sprite sheets into atlas pages and writes the frame table read by GameUtils::TextureAtlas.
+// Usage: AtlasPacker <outputDir> [--page-size N] [--frame name=WxH]... <sheet.png>...
+
+namespace
+{
+    constexpr int atlasPadding = 2;
+
+    struct Sheet
+    {
+        std::string name;
+        sf::Image image;
+        sf::Vector2i frameSize;
+        int page = 0;
+        sf::Vector2i position;
+    };
+
+    struct Shelf
+    {
+        int y;
+        int height;
+        int cursorX;
+    };
+
+    struct Page
+    {
+        std::vector<Shelf> shelves;
+        int nextShelfY = 0;
+    };
+
+    bool ParseSize(const std::string& text, sf::Vector2i& size)
+    {
+        auto separator = text.find('x');
+        if(separator == std::string::npos) return false;
+        size = {std::stoi(text.substr(0, separator)), std::stoi(text.substr(separator + 1))};
+        return size.x > 0 && size.y > 0;
+    }
+
+    // Shelf packing, sheets are expected sorted by decreasing height
+    bool Place(Page& page, Sheet& sheet, const int& pageSize)
+    {
+        auto width = static_cast<int>(sheet.image.getSize().x) + atlasPadding;
+        auto height = static_cast<int>(sheet.image.getSize().y) + atlasPadding;
+        for(auto& shelf : page.shelves)
+        {
+            if(height <= shelf.height && shelf.cursorX + width <= pageSize)
+            {
+                sheet.position = {shelf.cursorX, shelf.y};
+                shelf.cursorX += width;
+                return true;
+            }
+        }
+
+        if(page.nextShelfY + height > pageSize || width > pageSize) return false;
+        page.shelves.push_back({page.nextShelfY, height, width});
+        sheet.position = {0, page.nextShelfY};
+        page.nextShelfY += height;
+        return true;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if(argc < 3)
+    {
+        std::cerr << "Usage: AtlasPacker <outputDir> [--page-size N] [--frame name=WxH]... <sheet.png>..." << std::endl;
+        return 1;
+    }
+
+    std::filesystem::path outputDir = argv[1];
+    int pageSize = 1024;
+    sf::Vector2i defaultFrameSize{32, 32};
+    std::map<std::string, sf::Vector2i> frameSizes;
+    std::vector<Sheet> sheets;
+
+    for(int arg = 2; arg < argc; arg++)
+    {
+        std::string value = argv[arg];
+        if(value == "--page-size" && arg + 1 < argc)
+        {
+            pageSize = std::stoi(argv[++arg]);
+        }
+        else if(value == "--frame" && arg + 1 < argc)
+        {
+            std::string frame = argv[++arg];
+            auto separator = frame.find('=');
+            sf::Vector2i size;
+            if(separator == std::string::npos || !ParseSize(frame.substr(separator + 1), size))
+            {
+                std::cerr << "Invalid frame size " << frame << std::endl;
+                return 1;
+            }
+            frameSizes[frame.substr(0, separator)] = size;
+        }
+        else
+        {
+            Sheet sheet;
+            sheet.name = std::filesystem::path(value).filename().string();
+            if(!sheet.image.loadFromFile(value))
+            {
+                std::cerr << "Could not load " << value << std::endl;
+                return 1;
+            }
+            sheets.push_back(std::move(sheet));
+        }
+    }
+
+    for(auto& sheet : sheets)
+    {
+        auto frameIter = frameSizes.find(sheet.name);
+        sheet.frameSize = frameIter != frameSizes.end() ? frameIter->second : defaultFrameSize;
+    }
+
+    std::sort(sheets.begin(), sheets.end(), [](const Sheet& lhs, const Sheet& rhs){
+        if(lhs.image.getSize().y != rhs.image.getSize().y) return lhs.image.getSize().y > rhs.image.getSize().y;
+        return lhs.name < rhs.name;
+    });
+
+    std::vector<Page> pages;
+    for(auto& sheet : sheets)
+    {
+        bool placed = false;
+        for(std::size_t page = 0; page < pages.size() && !placed; page++)
+        {
+            placed = Place(pages[page], sheet, pageSize);
+            if(placed) sheet.page = static_cast<int>(page);
+        }
+        if(!placed)
+        {
+            pages.emplace_back();
+            if(!Place(pages.back(), sheet, pageSize))
+            {
+                std::cerr << sheet.name << " does not fit in a " << pageSize << " page" << std::endl;
+                return 1;
+            }
+            sheet.page = static_cast<int>(pages.size() - 1);
+        }
+    }
+
+    //Every page gets a transparent cell, frames outside a sheet are mapped there instead of onto a neighbour
+    sf::Vector2i emptySize = defaultFrameSize;
+    for(auto& sheet : sheets)
+        emptySize = {std::max(emptySize.x, sheet.frameSize.x), std::max(emptySize.y, sheet.frameSize.y)};
+    std::vector<Sheet> emptyCells(pages.size());
+    for(std::size_t page = 0; page < pages.size(); page++)
+    {
+        emptyCells[page].image.create(emptySize.x, emptySize.y, sf::Color::Transparent);
+        emptyCells[page].page = static_cast<int>(page);
+        if(!Place(pages[page], emptyCells[page], pageSize))
+        {
+            std::cerr << "No room for the empty cell on page " << page << ", increase --page-size" << std::endl;
+            return 1;
+        }
+    }
+
+    std::filesystem::create_directories(outputDir);
+    std::ofstream table(outputDir / "atlas.txt");
+    for(std::size_t page = 0; page < pages.size(); page++)
+    {
+        //Pages are cropped to the used height, the width stays a full page
+        sf::Image pageImage;
+        pageImage.create(pageSize, std::max(1, pages[page].nextShelfY), sf::Color::Transparent);
+        for(auto& sheet : sheets)
+        {
+            if(sheet.page == static_cast<int>(page))
+                pageImage.copy(sheet.image, sheet.position.x, sheet.position.y);
+        }
+
+        auto pageName = "atlas-" + std::to_string(page) + ".png";
+        if(!pageImage.saveToFile((outputDir / pageName).string()))
+        {
+            std::cerr << "Could not write " << pageName << std::endl;
+            return 1;
+        }
+        table << "page " << page << " " << pageName << " "
+            << emptyCells[page].position.x << " " << emptyCells[page].position.y << " " << emptySize.x << " " << emptySize.y << "\n";
+    }
+
+    for(auto& sheet : sheets)
+    {
+        table << "sprite " << sheet.name << " " << sheet.page << " "
+            << sheet.position.x << " " << sheet.position.y << " "
+            << sheet.image.getSize().x << " " << sheet.image.getSize().y << " "
+            << sheet.frameSize.x << " " << sheet.frameSize.y << "\n";
+    }
+
+    std::cout << "Packed " << sheets.size() << " sheets into " << pages.size() << " page(s)" << std::endl;
+    return 0;
+}
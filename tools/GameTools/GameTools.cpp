@@ -0,0 +1,510 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <functional>
+#include <numeric>
+
+#include "GameThread/GameThread.h"
+#include "SpriteBatch/SpriteBatch.h"
+#include "ObjectStore/ObjectStore.h"
+#include "ProjectilePool/ProjectilePool.h"
+#include "TimerWheel/TimerWheel.h"
+#include "Collision/CollisionKernel.h"
+#include "Palette/Palette.h"
+#include "Random/Random.h"
+#include "Replay/Replay.h"
+#include "Profiler/Profiler.h"
+#include "AllocationTracker/AllocationTracker.h"
+
+#include "SFML/Graphics.hpp"
+
+// Console front end of the game: headless sessions, replays and benchmarks share the game sources.
+// Usage: GameTools --headless [games] [maxTicks] [seed] [record] [trace] | --replay <path> [trace] | --palette-check
+//        GameTools --logic-bench|--columns-bench|--pool-bench|--collision-bench|--render-bench [size] [iterations]
+// Every mode accepts --alloc-budget N.
+
+namespace
+{
+    void StartProfiling(const std::string& tracePath)
+    {
+        if(tracePath.empty()) return;
+        GameUtils::Profiler::Instance().SetEnabled(true);
+        GameUtils::Profiler::Instance().SetThreadName("simulation");
+        GameUtils::AllocationTracker::Instance().SetSampleInterval(1);
+    }
+
+    // Prints the per zone summary and writes the Chrome trace, no-op when profiling was not requested
+    void FinishProfiling(const std::string& tracePath)
+    {
+        if(tracePath.empty()) return;
+        GameUtils::Profiler::Instance().SetEnabled(false);
+        for(const auto& zone : GameUtils::Profiler::Instance().Summarize())
+            std::cout << zone.name << ": " << zone.count << " zones, p50 " << zone.p50Ms << " ms, p99 " << zone.p99Ms << " ms, total " << zone.totalMs << " ms" << std::endl;
+        GameUtils::AllocationTracker::Instance().SetSampleInterval(0);
+        for(const auto& zone : GameUtils::AllocationTracker::Instance().GetZoneSamples())
+            std::cout << zone.zone << ": " << zone.samples << " allocations" << std::endl;
+        if(!GameUtils::Profiler::Instance().ExportChromeTrace(tracePath))
+            std::cerr << "could not write trace " << tracePath << std::endl;
+    }
+
+    // Takes "--alloc-budget N" out of the arguments wherever it appears so every mode accepts it
+    uint64_t ExtractAllocationBudget(int& argc, char* argv[])
+    {
+        for(int arg = 1; arg + 1 < argc; arg++)
+        {
+            if(std::string(argv[arg]) != "--alloc-budget") continue;
+            auto budget = std::stoull(argv[arg + 1]);
+            for(int next = arg + 2; next < argc; next++)
+                argv[next - 2] = argv[next];
+            argc -= 2;
+            return budget;
+        }
+        return 0;
+    }
+
+    // Worst tick and over budget count of the simulation thread, printed when a budget was set
+    void ReportAllocations()
+    {
+        auto stats = GameUtils::AllocationTracker::Instance().GetTickStats();
+        if(stats.budget == 0) return;
+        std::cout << "allocations: worst tick " << stats.worstTick << " with " << stats.worstTickAllocations << ", "
+                  << stats.overBudgetTicks << " ticks over the budget of " << stats.budget << std::endl;
+    }
+
+    // Headless pilot: always fires and sweeps the ship from wall to wall
+    void SteerHeadless(GameEngine::SimulationInput& input, const GameEngine::SimulationState& state)
+    {
+        input.fire = !input.fire;
+        if(state.playerPosition.x < 50) { input.left = false; input.right = true; }
+        else if(state.playerPosition.x > 700) { input.left = true; input.right = false; }
+    }
+
+    // Plays games without a window, steered by SteerHeadless
+    int RunHeadless(const int& games, const GameUtils::Tick& maxTicksPerGame, const std::string& recordPath)
+    {
+        GameEngine::GameThread gameThread(sf::Vector2f{800, 600});
+        auto recorder = std::make_shared<GameEngine::ReplayRecorder>(GameUtils::Random::Instance().GetSeed(), gameThread.GetViewportSize());
+        if(!recordPath.empty())
+            gameThread.SetRecorder(recorder);
+        GameEngine::SimulationInput input;
+        GameEngine::SimulationState state;
+        input.right = true;
+
+        std::cout << "seed " << GameUtils::Random::Instance().GetSeed() << std::endl;
+        auto startTime = std::chrono::steady_clock::now();
+        GameUtils::Tick totalTicks = 0;
+        for(int game = 0; game < games; game++)
+        {
+            input.confirm = true;
+            state = gameThread.Step(input);
+            input.confirm = false;
+
+            auto startTick = state.tick;
+            while(state.progression != GameUtils::Progression::GAME_OVER && state.tick - startTick < maxTicksPerGame)
+            {
+                SteerHeadless(input, state);
+                state = gameThread.Step(input);
+            }
+            totalTicks += state.tick - startTick;
+            std::cout << "game " << game << ": score " << state.score << ", ticks " << state.tick - startTick << ", objects " << state.objects << std::endl;
+        }
+
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        std::cout << "highscore " << state.highscore << ", " << totalTicks << " ticks in " << elapsed << "s (" << (elapsed > 0 ? totalTicks/elapsed : 0) << " ticks/s)" << std::endl;
+        auto arena = gameThread.GetFrameArenaStats();
+        std::cout << "frame arena: peak " << arena.highWaterBytes << " of " << arena.capacity << " bytes, " << arena.fallbacks << " fallbacks (" << arena.fallbackBytes << " bytes)" << std::endl;
+        for(auto kind = 0; kind < static_cast<int>(GameEngine::ProjectileKind::COUNT); ++kind)
+        {
+            auto projectileKind = static_cast<GameEngine::ProjectileKind>(kind);
+            auto pool = gameThread.GetProjectilePool().GetStats(projectileKind);
+            std::cout << "pool " << GameEngine::ProjectilePool::KindToString(projectileKind) << ": capacity " << pool.capacity << ", peak " << pool.peakLive
+                      << ", " << pool.spawns << " spawns, " << pool.overflows << " overflows" << std::endl;
+        }
+        if(!recordPath.empty() && !recorder->GetReplay().Save(recordPath))
+        {
+            std::cerr << "could not write replay " << recordPath << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    // Feeds a recorded session to a headless simulation as fast as it runs, stopping at the first desync
+    int RunReplay(const std::string& path)
+    {
+        GameEngine::Replay replay;
+        if(!replay.Load(path))
+        {
+            std::cerr << "could not read replay " << path << std::endl;
+            return 1;
+        }
+
+        GameUtils::Random::Instance().Seed(replay.seed);
+        GameEngine::GameThread gameThread(sf::Vector2f(replay.viewportSize));
+        GameEngine::ReplayPlayer player(replay);
+        GameEngine::SimulationState state;
+
+        auto startTime = std::chrono::steady_clock::now();
+        while(!player.Finished())
+        {
+            state = gameThread.Step(player.Next());
+            if(!player.Verify(state.stateHash))
+            {
+                std::cerr << "desync at tick " << player.GetTick() << " of " << replay.ticks << std::endl;
+                return 2;
+            }
+        }
+
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        std::cout << "replay ok: seed " << replay.seed << ", " << replay.ticks << " ticks in " << elapsed << "s (" << (elapsed > 0 ? replay.ticks/elapsed : 0) << " ticks/s), score " << state.score << std::endl;
+        return 0;
+    }
+
+    // Times headless ticks of a scripted session with a fixed seed, a new game starts whenever one ends.
+    // Per object type logic cost comes from the profiler zones of the last ticks that fit its ring.
+    int RunLogicBenchmark(const GameUtils::Tick& ticks)
+    {
+        GameUtils::Random::Instance().Seed(1);
+        GameEngine::GameThread gameThread(sf::Vector2f{800, 600});
+        GameEngine::SimulationInput input;
+        GameEngine::SimulationState state;
+        input.right = true;
+
+        GameUtils::Profiler::Instance().SetEnabled(true);
+        std::vector<double> tickUs;
+        tickUs.reserve(ticks);
+        for(GameUtils::Tick tick = 0; tick < ticks; tick++)
+        {
+            input.confirm = state.progression == GameUtils::Progression::MENU || state.progression == GameUtils::Progression::GAME_OVER;
+            SteerHeadless(input, state);
+            auto startTime = std::chrono::steady_clock::now();
+            state = gameThread.Step(input);
+            tickUs.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count());
+        }
+        GameUtils::Profiler::Instance().SetEnabled(false);
+
+        auto total = std::accumulate(tickUs.begin(), tickUs.end(), 0.0);
+        std::sort(tickUs.begin(), tickUs.end());
+        std::cout << ticks << " ticks: mean " << total / ticks << " us, p50 " << tickUs[ticks / 2] << " us, p99 " << tickUs[ticks * 99 / 100] << " us" << std::endl;
+        for(const auto& zone : GameUtils::Profiler::Instance().Summarize())
+        {
+            if(zone.name != "ExecuteLogic" && zone.name.rfind("Logic/", 0) != 0) continue;
+            std::cout << zone.name << ": " << zone.count << " zones, p50 " << zone.p50Ms * 1000.0 << " us, p99 " << zone.p99Ms * 1000.0 << " us" << std::endl;
+        }
+        return 0;
+    }
+
+    // Moves entities every tick, then reads their world hit boxes the way the broad phase does. Once with the positions
+    // in each Object's sprite, as they were stored before the columns, and once through the columns: the movement pass
+    // and a read of the hitbox arrays. Both see the same positions, so the hit counts match.
+    int RunColumnsBenchmark(const int& entityCount, const int& ticks)
+    {
+        GameUtils::ObjectStore store;
+        for(int index = 0; index < entityCount; index++)
+        {
+            auto& obj = store.Create();
+            auto x = static_cast<float>((index * 37) % 800);
+            auto y = static_cast<float>((index * 53) % 600);
+            obj.GetSprite().setPosition(x, y);
+            obj.SetPosition(x, y);
+            obj.SetVelocity(1.0f, 0.0f);
+        }
+
+        double objectsMoveMs = 0.0, objectsReadMs = 0.0, columnsMoveMs = 0.0, columnsReadMs = 0.0;
+        std::size_t objectHits = 0, columnHits = 0;
+        auto measure = [](double& totalMs, const std::function<void()>& pass)
+        {
+            auto startTime = std::chrono::steady_clock::now();
+            pass();
+            totalMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+        };
+
+        for(int tick = 0; tick < ticks; tick++)
+        {
+            measure(objectsMoveMs, [&]()
+            {
+                for(auto& obj : store)
+                {
+                    auto position = obj.GetSprite().getPosition();
+                    obj.GetSprite().setPosition(position.x + 1.0f, position.y);
+                }
+            });
+            measure(objectsReadMs, [&]()
+            {
+                for(auto& obj : store)
+                {
+                    auto position = obj.GetSprite().getPosition();
+                    auto hitBox = obj.GetHitBox();
+                    auto left = static_cast<int>(position.x) + hitBox.left;
+                    auto top = static_cast<int>(position.y) + hitBox.top;
+                    objectHits += left + hitBox.width >= 400 && top + hitBox.height >= 300;
+                }
+            });
+
+            measure(columnsMoveMs, [&]() { store.Move(); });
+            measure(columnsReadMs, [&]()
+            {
+                const auto& columns = store.GetColumns();
+                for(std::size_t index = 0; index < columns.Size(); index++)
+                    columnHits += columns.alive[index] && columns.hitBoxX[index] + columns.hitBoxWidth[index] >= 400 && columns.hitBoxY[index] + columns.hitBoxHeight[index] >= 300;
+            });
+        }
+
+        auto objectsMs = (objectsMoveMs + objectsReadMs) / ticks;
+        auto columnsMs = (columnsMoveMs + columnsReadMs) / ticks;
+        std::cout << entityCount << " entities, " << ticks << " ticks, " << objectHits << "/" << columnHits << " hits" << std::endl;
+        std::cout << "objects: move " << objectsMoveMs / ticks << " ms, hitboxes " << objectsReadMs / ticks << " ms, " << objectsMs << " ms/tick" << std::endl;
+        std::cout << "columns: move " << columnsMoveMs / ticks << " ms, hitboxes " << columnsReadMs / ticks << " ms, " << columnsMs << " ms/tick" << std::endl;
+        return objectHits == columnHits ? 0 : 2;
+    }
+
+    // Compares the vector and scalar RemapPixels on every byte value in every channel, for every start offset and tail length
+    int RunPaletteCheck()
+    {
+        std::size_t runs = 0;
+        std::size_t mismatches = 0;
+        for(uint32_t byte = 0; byte < 256; byte++)
+        {
+            //Colors are 0xRRGGBBAA, the byte is placed in each channel and in all of them
+            std::vector<std::pair<uint32_t, uint32_t>> remap;
+            for(auto shift = 0; shift < 32; shift += 8)
+                remap.emplace_back(byte << shift, ~(byte << shift));
+            remap.emplace_back(byte * 0x01010101u, (255 - byte) * 0x01010101u);
+            GameUtils::Palette palette("check", remap);
+
+            std::vector<uint8_t> pixels;
+            for(const auto& [from, to] : remap)
+                for(auto color : {from, to, from ^ 1u, from ^ 0x80000000u})
+                    for(auto shift = 24; shift >= 0; shift -= 8)
+                        pixels.push_back(static_cast<uint8_t>(color >> shift));
+
+            auto pixelCount = pixels.size() / 4;
+            for(std::size_t start = 0; start < 4; start++)
+            {
+                for(auto count = std::size_t{0}; start + count <= pixelCount; count++)
+                {
+                    auto vector = pixels;
+                    auto scalar = pixels;
+                    GameUtils::RemapPixels(vector.data() + start * 4, count, palette);
+                    GameUtils::RemapPixelsScalar(scalar.data() + start * 4, count, palette);
+                    mismatches += vector != scalar;
+                    ++runs;
+                }
+            }
+        }
+        std::cout << "palette check: " << runs << " runs, " << mismatches << " mismatches" << std::endl;
+        return mismatches == 0 ? 0 : 2;
+    }
+
+    // Fires a burst of projectiles every 10 ticks through a ProjectilePool, each one lives 100 ticks.
+    // After a warm up pass every tick is bracketed by the AllocationTracker, any heap allocation fails the run.
+    int RunPoolBenchmark(const int& burst, const int& ticks)
+    {
+        constexpr int burstInterval = 10;
+        GameUtils::ObjectStore store;
+        GameEngine::ProjectilePool pool(store);
+        //An UNKNOWN object loads no texture or sound, the bench only exercises the pool
+        GameEngine::ProjectileKindDesc shot;
+        shot.id = "UNKNOWN";
+        shot.logic = [&store](GameUtils::Object& obj)
+        {
+            obj.SetVelocity(0.0f, -6.0f);
+            if(obj.GetPosition().y < 0.0f)
+                store.Destroy(obj.GetHandle());
+        };
+        shot.capacity = static_cast<std::size_t>(burst) * (100 / burstInterval + 1);
+        pool.Register(GameEngine::ProjectileKind::PLAYER_SHOT, shot);
+
+        auto& tracker = GameUtils::AllocationTracker::Instance();
+        uint64_t allocations = 0;
+        double spawnMs = 0.0;
+        auto runTick = [&](const int& tick)
+        {
+            tracker.BeginTick();
+            auto startTime = std::chrono::steady_clock::now();
+            for(int index = 0; tick % burstInterval == 0 && index < burst; index++)
+            {
+                pool.Spawn(GameEngine::ProjectileKind::PLAYER_SHOT, [&](GameUtils::Object& obj)
+                {
+                    obj.SetPosition(static_cast<float>(index % 800), 600.0f);
+                });
+            }
+            spawnMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+            for(auto& obj : store)
+                obj.StepLogic();
+            store.Flush();
+            store.Move();
+            GameUtils::TimerWheel::Instance().Advance(GameUtils::GetCurrentTick());
+            GameUtils::AdvanceTick();
+            return tracker.EndTick(GameUtils::GetCurrentTick()).allocations;
+        };
+
+        for(int tick = 0; tick < 200; tick++)
+            runTick(tick);
+        spawnMs = 0.0;
+        for(int tick = 0; tick < ticks; tick++)
+            allocations += runTick(tick);
+
+        auto stats = pool.GetStats(GameEngine::ProjectileKind::PLAYER_SHOT);
+        auto spawns = static_cast<double>(burst) * ((ticks + burstInterval - 1) / burstInterval);
+        std::cout << burst << " shots every " << burstInterval << " ticks, " << ticks << " ticks, capacity " << stats.capacity << ", peak " << stats.peakLive << ", " << stats.overflows << " overflows" << std::endl;
+        std::cout << "spawn: " << (spawns > 0 ? spawnMs * 1e6 / spawns : 0.0) << " ns, " << allocations << " heap allocations" << std::endl;
+        return allocations == 0 ? 0 : 2;
+    }
+
+    // Times the narrow phase kernel against its scalar reference on the same pairs and checks they agree.
+    // Every 16th pair is far out of the 16 bit range to exercise the kernel's fallback.
+    int RunCollisionBenchmark(const int& pairCount, const int& iterations)
+    {
+        GameUtils::Pcg32 rng(1, 0);
+        std::vector<int32_t> ax(pairCount), ay(pairCount), bx(pairCount), by(pairCount), radius(pairCount);
+        for(int index = 0; index < pairCount; index++)
+        {
+            auto extent = index % 16 == 15 ? 60000 : 800;
+            ax[index] = rng.Range(-extent, extent);
+            ay[index] = rng.Range(-extent, extent);
+            bx[index] = ax[index] + rng.Range(-64, 64) + (index % 32 == 31 ? extent : 0);
+            by[index] = ay[index] + rng.Range(-64, 64) + (index % 32 == 31 ? extent : 0);
+            radius[index] = rng.Range(8, 48);
+        }
+
+        std::vector<uint8_t> hits(pairCount), reference(pairCount);
+        auto measure = [&](const std::function<void(uint8_t*)>& kernel, std::vector<uint8_t>& out)
+        {
+            auto startTime = std::chrono::steady_clock::now();
+            for(int iteration = 0; iteration < iterations; iteration++)
+                kernel(out.data());
+            return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count() / (static_cast<double>(iterations) * pairCount);
+        };
+        auto scalarNs = measure([&](uint8_t* out) { GameUtils::CircleTestBatchScalar(ax.data(), ay.data(), bx.data(), by.data(), radius.data(), out, pairCount); }, reference);
+        auto kernelNs = measure([&](uint8_t* out) { GameUtils::CircleTestBatch(ax.data(), ay.data(), bx.data(), by.data(), radius.data(), out, pairCount); }, hits);
+
+        auto mismatches = 0;
+        for(int index = 0; index < pairCount; index++)
+            mismatches += hits[index] != reference[index];
+        std::cout << pairCount << " pairs, " << iterations << " iterations, " << std::count(reference.begin(), reference.end(), 1) << " hits" << std::endl;
+        std::cout << "scalar: " << scalarNs << " ns/pair" << std::endl;
+        std::cout << GameUtils::CollisionKernelName() << ": " << kernelNs << " ns/pair, " << mismatches << " mismatches" << std::endl;
+        return mismatches == 0 ? 0 : 2;
+    }
+
+    // Renders sprites into an offscreen target, once per sprite and once through SpriteBatch
+    int RunRenderBenchmark(const int& spriteCount, const int& frames)
+    {
+        sf::RenderTexture target;
+        target.create(800, 600);
+        std::vector<std::shared_ptr<const sf::Texture>> textures{
+            GameUtils::TextureCache::Instance().Get("../resources/texture/animated-projectile.png"),
+            GameUtils::TextureCache::Instance().Get("../resources/texture/animated-enemy-projectile.png"),
+            GameUtils::TextureCache::Instance().Get("../resources/texture/animated-enemy-ship.png")};
+
+        std::vector<sf::Sprite> sprites(spriteCount);
+        for(int index = 0; index < spriteCount; index++)
+        {
+            sprites[index].setTexture(*textures[index % textures.size()]);
+            sprites[index].setTextureRect({0, 0, 16, 16});
+            sprites[index].setPosition(static_cast<float>((index * 37) % 800), static_cast<float>((index * 53) % 600));
+        }
+
+        auto measure = [&](const std::function<std::size_t()>& render)
+        {
+            std::size_t drawCalls = 0;
+            auto startTime = std::chrono::steady_clock::now();
+            for(int frame = 0; frame < frames; frame++)
+            {
+                target.clear();
+                drawCalls = render();
+                target.display();
+            }
+            auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+            return std::make_pair(elapsed / frames, drawCalls);
+        };
+
+        auto [directMs, directCalls] = measure([&]()
+        {
+            for(auto& sprite : sprites)
+                target.draw(sprite);
+            return sprites.size();
+        });
+
+        GameEngine::SpriteBatch spriteBatch;
+        auto [batchedMs, batchedCalls] = measure([&]()
+        {
+            spriteBatch.Begin();
+            for(auto& sprite : sprites)
+                spriteBatch.Add(sprite);
+            spriteBatch.Submit(target);
+            return spriteBatch.GetStats().drawCalls;
+        });
+
+        std::cout << spriteCount << " sprites, " << frames << " frames" << std::endl;
+        std::cout << "direct:  " << directMs << " ms/frame, " << directCalls << " draw calls" << std::endl;
+        std::cout << "batched: " << batchedMs << " ms/frame, " << batchedCalls << " draw calls" << std::endl;
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    //--alloc-budget N reports simulation ticks making more than N heap allocations, in any mode
+    GameUtils::AllocationTracker::Instance().SetTickBudget(ExtractAllocationBudget(argc, argv));
+
+    if(argc > 1 && std::string(argv[1]) == "--headless")
+    {
+        int games = argc > 2 ? std::stoi(argv[2]) : 1;
+        GameUtils::Tick maxTicks = argc > 3 ? std::stoull(argv[3]) : 60 * 60 * 60;
+        GameUtils::Random::Instance().Seed(argc > 4 ? std::stoull(argv[4]) : GameUtils::Random::EntropySeed());
+        std::string tracePath = argc > 6 ? argv[6] : "";
+        StartProfiling(tracePath);
+        auto result = RunHeadless(games, maxTicks, argc > 5 ? argv[5] : "");
+        FinishProfiling(tracePath);
+        ReportAllocations();
+        return result;
+    }
+    if(argc > 2 && std::string(argv[1]) == "--replay")
+    {
+        std::string tracePath = argc > 3 ? argv[3] : "";
+        StartProfiling(tracePath);
+        auto result = RunReplay(argv[2]);
+        FinishProfiling(tracePath);
+        ReportAllocations();
+        return result;
+    }
+    if(argc > 1 && std::string(argv[1]) == "--render-bench")
+    {
+        int sprites = argc > 2 ? std::stoi(argv[2]) : 5000;
+        int frames = argc > 3 ? std::stoi(argv[3]) : 200;
+        return RunRenderBenchmark(sprites, frames);
+    }
+    if(argc > 1 && std::string(argv[1]) == "--columns-bench")
+    {
+        int entities = argc > 2 ? std::stoi(argv[2]) : 10000;
+        int ticks = argc > 3 ? std::stoi(argv[3]) : 500;
+        return RunColumnsBenchmark(entities, ticks);
+    }
+    if(argc > 1 && std::string(argv[1]) == "--palette-check")
+        return RunPaletteCheck();
+    if(argc > 1 && std::string(argv[1]) == "--pool-bench")
+    {
+        int burst = argc > 2 ? std::stoi(argv[2]) : 2000;
+        int ticks = argc > 3 ? std::stoi(argv[3]) : 3000;
+        return RunPoolBenchmark(burst, ticks);
+    }
+    if(argc > 1 && std::string(argv[1]) == "--collision-bench")
+    {
+        int pairs = argc > 2 ? std::stoi(argv[2]) : 4099;
+        int iterations = argc > 3 ? std::stoi(argv[3]) : 2000;
+        return RunCollisionBenchmark(pairs, iterations);
+    }
+    if(argc > 1 && std::string(argv[1]) == "--logic-bench")
+    {
+        GameUtils::Tick ticks = argc > 2 ? std::stoull(argv[2]) : 20000;
+        return ticks > 0 ? RunLogicBenchmark(ticks) : 1;
+    }
+
+    std::cerr << "Usage: GameTools --headless [games] [maxTicks] [seed] [record] [trace] | --replay <path> [trace] | --palette-check" << std::endl;
+    std::cerr << "       GameTools --logic-bench|--columns-bench|--pool-bench|--collision-bench|--render-bench [size] [iterations]" << std::endl;
+    return 1;
+}
@@ -1,11 +1,44 @@
+#include <atomic>
+
 #include "GameUtils.h"
 
 namespace GameUtils
 {
-    bool IsExpired(const std::chrono::time_point<std::chrono::steady_clock>& auxiliarTimestamp, const int& ticks) 
+    namespace
+    {
+      std::atomic<Tick> currentTick = 0;
+      std::atomic<int64_t> tickDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(globalFrametime).count();
+    }
+
+    void SetTickDuration(const std::chrono::nanoseconds& duration)
+    {
+      tickDuration = std::max<int64_t>(duration.count(), 1);
+    }
+
+    std::chrono::nanoseconds GetTickDuration()
+    {
+      return std::chrono::nanoseconds(tickDuration.load());
+    }
+
+    Tick GetCurrentTick()
+    {
+      return currentTick.load(std::memory_order_relaxed);
+    }
+
+    void AdvanceTick()
+    {
+      currentTick.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void ResetTicks()
+    {
+      currentTick = 0;
+    }
+
+    Tick MillisecondsToTicks(const std::chrono::milliseconds& time)
     {
-      auto test = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - auxiliarTimestamp);
-      auto result = (test >= (globalFrametime * ticks)) ? true : false;
-      return result;
+      auto duration = tickDuration.load();
+      auto ticks = (std::chrono::duration_cast<std::chrono::nanoseconds>(time).count() + duration - 1) / duration;
+      return static_cast<Tick>(std::max<int64_t>(ticks, 1));
     }
 }
\ No newline at end of file
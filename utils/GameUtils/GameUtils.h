@@ -6,6 +6,8 @@
 #include <future>
 #include <iostream>
 #include <utility>
+#include <chrono>
+#include <cstdint>
 
 #include "SFML/Window.hpp"
 #include "SFML/Graphics.hpp"
@@ -18,7 +20,17 @@ namespace GameUtils
     constexpr uint32_t red = 0xAC3232FF;
     constexpr uint32_t darkerRed = 0x822929FF;
     constexpr std::array<int,2> enemyQuantity = {4,4};
+    // Default duration of one simulation tick
     constexpr auto globalFrametime = 17ms;
+    // Simulation steps run back to back are capped so a stall does not snowball into a catch-up burst
+    constexpr int maxTicksPerFrame = 8;
+    // Interval between two rendered frames, and the slower one used on menu, pause and game over screens
+    constexpr auto renderFrametime = 16ms;
+    constexpr auto idleFrametime = 50ms;
+    constexpr bool useVerticalSync = false;
+    // Frame table generated by tools/AtlasPacker next to the executable
+    constexpr auto atlasTablePath = "atlas/atlas.txt";
+    using Tick = uint64_t;
     enum class TextType : int
     {
         SCORE = 0,
@@ -39,6 +51,11 @@ namespace GameUtils
       PAUSE
     };
     
-    bool IsExpired(const std::chrono::time_point<std::chrono::steady_clock>& auxiliarTimestamp, const int& ticks);
+    void SetTickDuration(const std::chrono::nanoseconds& duration);
+    std::chrono::nanoseconds GetTickDuration();
+    Tick GetCurrentTick();
+    void AdvanceTick();
+    void ResetTicks();
+    Tick MillisecondsToTicks(const std::chrono::milliseconds& time);
   
 }